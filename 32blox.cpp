@@ -16,15 +16,67 @@
 
 /* System headers. */
 
+#ifndef TARGET_32BLIT_HW
+#include <chrono>
+#include <thread>
+#endif
+
+
 /* Local headers. */
 
 #include "32blit.hpp"
 #include "32blox.hpp"
 
 
+/* Constants. */
+
+#define IDLE_MAX_SLEEP  10    /* Don't doze so long we miss the buttons. */
+
+
 /* Module variables. */
 
 static gamestate_t m_gamestate = STATE_SPLASH;
+static const struct {
+  void        (*enter)( void );
+  void        (*exit)( void );
+  gamestate_t (*update)( void );
+  bool        (*render)( void );
+}                  m_states[STATE_MAX] = {
+  { splash_enter,   splash_exit,    splash_update,  splash_render },
+  { game_enter,     game_exit,      game_update,    game_render },
+  { death_enter,    death_exit,     death_update,   death_render },
+  { hiscore_enter,  hiscore_exit,   hiscore_update, hiscore_render }
+};
+
+
+/* Module functions. */
+
+/*
+ * _blox_idle - called when a render had nothing to do. On the host we can
+ *              give the CPU back until the next scheduled event, rather than
+ *              spinning; on the device, skipping the drawing is saving enough.
+ *
+ * uint32_t - the elapsed time (in ms) since the application launched.
+ */
+
+static void _blox_idle( uint32_t p_time )
+{
+#ifndef TARGET_32BLIT_HW
+  uint32_t l_wait;
+  
+  /* Wake for the next timer, but not so late that we miss any input. */
+  l_wait = schedule_next_due( p_time );
+  if ( l_wait > IDLE_MAX_SLEEP )
+  {
+    l_wait = IDLE_MAX_SLEEP;
+  }
+  if ( l_wait > 0 )
+  {
+    TRACE_SCOPE( "idle" );
+    std::this_thread::sleep_for( std::chrono::milliseconds( l_wait ) );
+  }
+#endif
+}
 
 
 /* Functions. */
@@ -44,11 +96,18 @@ void init( void )
   blit::fb.pen( rgba( 100, 0, 0, 255 ) );
   blit::fb.clear();
   
-  /* Set the initial gamestate (which should be redundant, but...) */
-  m_gamestate = STATE_SPLASH;
-  
   /* Initialise the high score storage. */
   hiscore_init();
+
+  /* Benchmark builds get their numbers before anything else happens. */
+  BENCH_RUN();
+  
+  /* Soak builds hand the game straight over to the autoplayer. */
+  AUTOPLAY_SOAK();
+  
+  /* Set the initial gamestate (which should be redundant, but...) */
+  m_gamestate = STATE_SPLASH;
+  m_states[m_gamestate].enter();
 }
 
 
@@ -60,37 +119,25 @@ void init( void )
 
 void update( uint32_t p_time )
 {
+  gamestate_t l_newstate;
+  TRACE_SCOPE( "update" );
 
-  /* What we're updating depends rather a lot on our current state. */
-  switch( m_gamestate ) {
-
-    case STATE_SPLASH:      /* Show the user a simple splash screen. */
-      m_gamestate = splash_update();
-      if ( m_gamestate == STATE_GAME )
-      {
-        game_init();
-      }
-      break;
-      
-    case STATE_GAME:        /* The player is, well, playing! */
-      m_gamestate = game_update();
-      break;
-      
-    case STATE_DEATH:       /* The game is done. Save the score. */
-      m_gamestate = death_update();
-      break;
-      
-    case STATE_HISCORE:     /* Show the high scores. */
-      m_gamestate = hiscore_update();
-      if ( m_gamestate == STATE_GAME )
-      {
-        game_init();
-      }
-      break;
-
-    default:                /* Erk! This should Not Be Possible. */
-      break;
+  /* Fire off anything that the scheduler has waiting. */
+  schedule_tick( p_time );
 
+  /* What we're updating depends rather a lot on our current state. */
+  AUDIT_BEGIN( AUDIT_UPDATE, m_gamestate );
+  l_newstate = m_states[m_gamestate].update();
+  AUDIT_END();
+  
+  /* If that state is done, let it tidy up before the next one starts. */
+  if ( ( l_newstate != m_gamestate ) && ( l_newstate < STATE_MAX ) )
+  {
+    m_states[m_gamestate].exit();
+    arena_reset();
+    AUDIT_REPORT();
+    m_gamestate = l_newstate;
+    m_states[m_gamestate].enter();
   }
 }
 
@@ -103,30 +150,18 @@ void update( uint32_t p_time )
 
 void render( uint32_t p_time )
 {
+  bool l_drawn;
+  TRACE_SCOPE( "render" );
 
   /* As with updates, what we render depends on our current gamestate. */
-  switch( m_gamestate ) { 
-
-    case STATE_SPLASH:      /* Show the user a simple splash screen. */
-      splash_render();
-      break;
-      
-    case STATE_GAME:        /* The player is, well, playing! */
-      game_render();
-      break;
-      
-    case STATE_DEATH:       /* Get the player name, if there's a high score. */
-      death_render();
-      break;
-      
-    case STATE_HISCORE:     /* Show the high scores. */
-      hiscore_render();
-      break;
-
-    default:                /* Erk! This should Not Be Possible. */
-      return;
-      break;
-
+  AUDIT_BEGIN( AUDIT_RENDER, m_gamestate );
+  l_drawn = m_states[m_gamestate].render();
+  AUDIT_END();
+  
+  /* If nothing changed, the last frame is still on screen; have a rest. */
+  if ( !l_drawn )
+  {
+    _blox_idle( p_time );
   }
 }
 
@@ -22,8 +22,34 @@
 
 #define MAX_BALLS     5
 #define MAX_SCORES    10
-#define BOARD_WIDTH   10
-#define BOARD_HEIGHT  10
+#define MAX_SCHEDULES 8
+#define ARENA_SIZE    24576
+#define SCHEDULE_NONE 0xff
+#define SCHEDULE_FOREVER  0xffffffff
+#define BOARD_MAX_COLUMNS 32
+#define BOARD_MAX_ROWS    32
+#define BOARD_PIXELS  320
+#define BOARD_OUTSIDE 0xff
+#define HUD_HEIGHT    9
+#define BRICK_TYPES   10
+#define GRID_CELL     8
+#define GRID_NONE     0xffff
+#define BRICK_FLAG_SOLID  0x01
+#define LEVEL_EVENTS  32
+#define LEVEL_SUBSCRIBERS 4
+#define LEVEL_NO_SUBSCRIBER 0xff
+#define INDEXED_COLOURS   256
+#define SPRITE_NONE   0xff
+#define INDEXED_FULL  0xffff
+#define PARTICLE_MAX  2048
+#define PARTICLE_COLOURS  16
+#define POWERUP_DROPS 32
+#define POWERUP_SLOW_TICKS 1000
+#define SNAPSHOT_IMAGE_SIZE 2048
+#define STORAGE_SNAPSHOT  256
+#define AUTOPLAY_LEFT     0x01
+#define AUTOPLAY_RIGHT    0x02
+#define AUTOPLAY_LAUNCH   0x04
 
 
 /* Enums. */
@@ -32,7 +58,8 @@ typedef enum {
   STATE_SPLASH,
   STATE_GAME,
   STATE_DEATH,
-  STATE_HISCORE
+  STATE_HISCORE,
+  STATE_MAX
 } gamestate_t;
 
 typedef enum {
@@ -47,60 +74,310 @@ typedef enum {
   ALIGN_BOTRIGHT
 } spritealign_t;
 
+typedef enum {
+  SPRITE_PACKED,
+  SPRITE_RAW,
+  SPRITE_RLE
+} spriteencoding_t;
+
+typedef enum {
+  AUDIT_UPDATE,
+  AUDIT_RENDER,
+  AUDIT_MAX
+} audit_call_t;
+
 typedef enum {
   BAT_NORMAL,
+  BAT_WIDE,
   BAT_MAX
 } battype_t;
 
+typedef enum {
+  POWERUP_MULTIBALL,
+  POWERUP_WIDE,
+  POWERUP_SLOW,
+  POWERUP_MAX
+} powerup_t;
+
 /* Structures. */
 
+typedef int32_t fixed_t;                /* Q16.16, for deterministic physics. */
+
+typedef void (*schedule_callback_t)( uint8_t );
+
+typedef struct {
+  const char       *name;
+  uint16_t          width;
+  uint16_t          height;
+  uint8_t           bitdepth;
+  uint16_t          palette_count;
+  uint16_t          packed_length;
+  uint16_t          cols;           /* Frames across the sheet.            */
+  uint16_t          rows;           /* Frames down the sheet.              */
+  spriteencoding_t  encoding;
+  const uint8_t    *packed;         /* The original packed_image.          */
+  const uint8_t    *pixels;         /* RAW or RLE data, NULL if PACKED.    */
+  const uint8_t    *mask;           /* One bit per pixel, rows byte padded */
+  const uint32_t   *frames;         /* Frame offsets into RAW pixels.      */
+} spritemeta_t;
+
+typedef struct {
+  uint8_t     sprite;           /* Sprite ID, from sprite_id.             */
+  uint8_t     hits;             /* Hits it takes to clear it.             */
+  uint8_t     score;            /* Points for each hit.                   */
+  uint8_t     flags;            /* BRICK_FLAG_*                           */
+  rgba        debris;           /* Colour of the bits knocked off it.     */
+} bricktype_t;
+
+typedef struct {
+  uint8_t     row;
+  uint8_t     column;
+  uint8_t     old_type;
+  uint8_t     new_type;
+  uint32_t    tick;             /* blit::now() when it happened.          */
+} brickevent_t;
+
 typedef struct {
   battype_t   type;
-  float       position;
+  fixed_t     position;
   uint16_t    baseline;
   uint8_t     width;
 } bat_t;
 
 
+/* Macros. */
+
+#define FIXED_SHIFT       16
+#define FIXED_ONE         ( 1 << FIXED_SHIFT )
+#define FIXED(f)          ( (fixed_t)( (f) * FIXED_ONE ) )    /* Constants only! */
+#define FIXED_FROM_INT(i) ( (fixed_t)(i) * FIXED_ONE )
+#define FIXED_INT(x)      ( (x) >> FIXED_SHIFT )
+#define FIXED_MUL(a,b)    ( (fixed_t)( ( (int64_t)(a) * (b) ) >> FIXED_SHIFT ) )
+
+#ifdef BLOX_AUDIT
+#define AUDIT_BEGIN(c,s)  audit_begin( c, s )
+#define AUDIT_END()       audit_end()
+#define AUDIT_REPORT()    audit_report()
+#else
+#define AUDIT_BEGIN(c,s)
+#define AUDIT_END()
+#define AUDIT_REPORT()
+#endif
+
+#ifdef BLOX_BENCH
+#define BENCH_RUN()       bench_run()
+#else
+#define BENCH_RUN()
+#endif
+
+#ifdef BLOX_AUTOPLAY
+#define AUTOPLAY_SOAK()   autoplay_start()
+#else
+#define AUTOPLAY_SOAK()
+#endif
+
+
 /* Function prototypes. */
 
 void        init( void );
 void        update( uint32_t );
 void        render( uint32_t );
 
+void       *arena_alloc( uint32_t );
+void        arena_reset( void );
+uint32_t    arena_used( void );
+uint32_t    arena_highwater( void );
+
+void        audit_begin( audit_call_t, gamestate_t );
+void        audit_end( void );
+void        audit_report( void );
+
+void        autoplay_start( void );
+bool        autoplay_active( void );
+uint8_t     autoplay_update( bat_t, const int8_t * );
+void        autoplay_end_game( uint32_t, uint8_t );
+uint32_t    autoplay_seed( void );
+
 uint8_t     ball_create( bat_t );
 uint8_t     ball_spawn( uint8_t );
 int8_t      ball_update( uint8_t, bat_t );
 void        ball_render( uint8_t );
 void        ball_launch( uint8_t );
 bool        ball_stuck( uint8_t );
+bool        ball_predict( uint8_t, bat_t, fixed_t *, uint16_t * );
+void        ball_reset( void );
+void        ball_slow( uint32_t );
+void        ball_collide_all( void );
+void        ball_end_tick( void );
+fixed_t     ball_substeps( uint16_t * );
+uint16_t    ball_save( uint8_t * );
+uint16_t    ball_restore( const uint8_t * );
+void        ball_bench( void );
+
+void        bench_run( void );
+
+void        board_init( uint8_t, uint8_t );
+uint8_t     board_columns( void );
+uint8_t     board_rows( void );
+uint8_t     board_column( int16_t );
+uint8_t     board_row( int16_t );
+int16_t     board_left( uint8_t );
+int16_t     board_top( uint8_t );
+rect        board_brick( uint8_t, uint8_t );
+size        board_brick_size( void );
+bool        board_full_size( void );
 
 bool        death_check_score( uint32_t );
+void        death_enter( void );
+void        death_exit( void );
 gamestate_t death_update( void );
-void        death_render( void );
+bool        death_render( void );
 
-void        game_init( void );
-void        game_render( void );
+void        effect_flicker_start( void );
+void        effect_flicker_stop( void );
+rgba        effect_text_colour( void );
+uint32_t    effect_generation( void );
+rgba       *effect_gradient_create( void );
+void        effect_gradient_render( const rgba * );
+bool        effect_backdrop_create( const rgba * );
+void        effect_backdrop_render( void );
+
+void        game_enter( void );
+void        game_exit( void );
+bool        game_render( void );
 gamestate_t game_update( void );
+uint16_t    game_save( uint8_t * );
+bool        game_restore( const uint8_t *, uint16_t );
+void        game_bench( void );
+
+bool        grid_create( uint16_t );
+void        grid_clear( void );
+uint16_t    grid_cell( int16_t, int16_t );
+void        grid_insert( uint16_t, int16_t, int16_t );
+uint16_t    grid_first( uint16_t );
+uint16_t    grid_next( uint16_t );
+uint16_t    grid_neighbour( uint16_t, int8_t, int8_t );
 
 void        hiscore_init( void );
+void        hiscore_enter( void );
+void        hiscore_exit( void );
 uint32_t    hiscore_get_score( uint8_t );
 void        hiscore_save_score( uint32_t, const char * );
 gamestate_t hiscore_update( void );
-void        hiscore_render( void );
+bool        hiscore_render( void );
+
+void        hud_init( void );
+void        hud_invalidate( void );
+void        hud_set_background( uint8_t, rgba );
+void        hud_set_hiscore( uint32_t );
+void        hud_set_score( uint32_t );
+void        hud_set_lives( uint8_t );
+rect        hud_render( void );
+
+bool        indexed_create( void );
+uint16_t    indexed_reserve( uint16_t );
+void        indexed_set_colour( uint8_t, rgba );
+uint16_t    indexed_add_colour( rgba );
+void        indexed_plot( int16_t, int16_t, uint8_t );
+void        indexed_hline( int16_t, uint8_t );
+void        indexed_rotate( uint8_t, uint16_t, uint16_t );
+void        indexed_render( void );
+void        indexed_release( void );
 
 void        level_init( uint8_t );
+void        level_load( uint8_t, uint8_t, const uint8_t * );
 uint8_t    *level_get_line( uint8_t );
-void        level_hit_brick( uint8_t, uint8_t );
-const char *level_get_bricktype( uint8_t );
+uint8_t     level_hit_brick( uint8_t, uint8_t );
+const bricktype_t *level_get_bricktype( uint8_t );
 uint16_t    level_get_bricks( void );
+uint32_t    level_get_rows( void );
+uint32_t    level_get_row_mask( uint8_t );
+uint8_t     level_get_row_bricks( uint8_t );
+uint16_t    level_save( uint8_t * );
+uint16_t    level_restore( const uint8_t * );
+uint8_t     level_subscribe( void );
+void        level_unsubscribe( uint8_t );
+bool        level_next_event( uint8_t, brickevent_t * );
+
+void        particle_init( void );
+void        particle_exit( void );
+void        particle_emit( fixed_t, fixed_t, uint16_t, rgba );
+void        particle_update( void );
+void        particle_render( void );
 
-void        splash_render( void );
+void        powerup_init( void );
+void        powerup_exit( void );
+uint8_t     powerup_update( bat_t );
+void        powerup_render( void );
+uint16_t    powerup_save( uint8_t * );
+uint16_t    powerup_restore( const uint8_t * );
+
+void        random_seed( uint32_t );
+uint16_t    random_range( uint16_t );
+uint16_t    random_save( uint8_t * );
+uint16_t    random_restore( const uint8_t * );
+
+uint8_t     schedule_create( schedule_callback_t, uint32_t, int16_t );
+void        schedule_start( uint8_t );
+void        schedule_start_after( uint8_t, uint32_t );
+void        schedule_stop( uint8_t );
+bool        schedule_running( uint8_t );
+uint32_t    schedule_time_left( uint8_t );
+uint32_t    schedule_next_due( uint32_t );
+void        schedule_tick( uint32_t );
+
+void        snapshot_reset( void );
+void        snapshot_record( void );
+bool        snapshot_rewind( uint16_t );
+uint16_t    snapshot_ticks( void );
+bool        snapshot_save( void );
+bool        snapshot_load( void );
+void        snapshot_discard( void );
+uint16_t    snapshot_put_32( uint8_t *, uint32_t );
+uint32_t    snapshot_get_32( const uint8_t * );
+uint16_t    snapshot_put_16( uint8_t *, uint16_t );
+uint16_t    snapshot_get_16( const uint8_t * );
+
+void        splash_enter( void );
+void        splash_exit( void );
+bool        splash_render( void );
 gamestate_t splash_update( void );
 
 void        sprite_render( const char *, int16_t, int16_t, spritealign_t = ALIGN_TOPLEFT );
+void        sprite_render_id( uint8_t, int16_t, int16_t, spritealign_t = ALIGN_TOPLEFT );
+uint8_t     sprite_id( const char * );
+uint16_t    sprite_frames( uint8_t );
+void        sprite_render_frame( uint8_t, uint16_t, int16_t, int16_t, spritealign_t = ALIGN_TOPLEFT );
+void        sprite_cache_flush( void );
+void        sprite_target_indexed( bool );
 size        sprite_size( const char * );
 bool        sprite_collide( const char *, int16_t, int16_t, spritealign_t, const char *, int16_t, int16_t, spritealign_t );
+bool        sprite_collide_id( uint8_t, int16_t, int16_t, spritealign_t, uint8_t, int16_t, int16_t, spritealign_t );
+
+bool        storage_read( uint32_t, uint8_t *, uint32_t );
+bool        storage_write( uint32_t, const uint8_t *, uint32_t );
+uint32_t    storage_crc( const uint8_t *, uint32_t );
+
+void        trace_event( const char *, char );
+void        trace_dump( void );
+
+
+/* Tracing. */
+
+#if defined( BLOX_TRACE ) && !defined( TARGET_32BLIT_HW )
+struct trace_scope_t {
+  const char *name;
+  trace_scope_t( const char *p_name ) : name( p_name ) { trace_event( name, 'B' ); }
+  ~trace_scope_t() { trace_event( name, 'E' ); }
+};
+#define TRACE_BEGIN(n)    trace_event( n, 'B' )
+#define TRACE_END(n)      trace_event( n, 'E' )
+#define TRACE_SCOPE(n)    trace_scope_t l_trace_scope( n )
+#else
+#define TRACE_BEGIN(n)
+#define TRACE_END(n)
+#define TRACE_SCOPE(n)
+#endif
 
 
 #endif /* _32BLOCK_HPP_ */
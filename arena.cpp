@@ -0,0 +1,123 @@
+/*
+ * arena.cpp - part of 32Blox, a breakout game for the 32blit built to
+ * explore the API.
+ *
+ * A simple bump allocator over a fixed block of memory, for the caches that
+ * each screen builds up while it's being shown. Nothing is ever freed on its
+ * own; the whole lot is thrown away in one go when the game state changes,
+ * so there's no fragmentation to worry about and only one state's worth of
+ * cache is ever held at once.
+ *
+ * We also keep track of the most that's ever been used, so that ARENA_SIZE
+ * can be set from real numbers rather than guesswork.
+ *
+ * Please note that this is a first attempt at understanding a somewhat fluid
+ * API on a shiny new bit of kit, so it probably is not full of 'best practice'.
+ * It will hopefully serve as some sort of starting point, however.
+ *
+ * Coyright (C) 2020 Pete Favelle <pete@fsquared.co.uk>
+ *
+ * This software is provided under the MIT License. See LICENSE.txt for details.
+ */
+
+/* System headers. */
+
+#include <stdio.h>
+
+
+/* Local headers. */
+
+#include "32blit.hpp"
+#include "32blox.hpp"
+
+
+/* Constants. */
+
+#define ARENA_ALIGN   8
+
+
+/* Module variables. */
+
+static uint8_t      m_arena[ARENA_SIZE] __attribute__ (( aligned( ARENA_ALIGN ) ));
+static uint32_t     m_used;
+static uint32_t     m_highwater;
+static uint32_t     m_reported;
+
+
+/* Functions. */
+
+/*
+ * arena_alloc - allocates a block from the arena. It stays valid until the
+ *               next arena_reset, which happens when the game state changes.
+ *
+ * uint32_t - the number of bytes required
+ *
+ * Returns a pointer to the block, or NULL if the arena is full.
+ */
+
+void *arena_alloc( uint32_t p_bytes )
+{
+  void    *l_block;
+  uint32_t l_size;
+
+  /* Round everything up, so the next allocation is suitably aligned. */
+  l_size = ( p_bytes + ( ARENA_ALIGN - 1 ) ) & ~( ARENA_ALIGN - 1 );
+  if ( l_size > ( ARENA_SIZE - m_used ) )
+  {
+    printf( "arena: out of space allocating %lu bytes (%lu/%d used)\n",
+            (unsigned long)p_bytes, (unsigned long)m_used, ARENA_SIZE );
+    return NULL;
+  }
+
+  l_block = &m_arena[m_used];
+  m_used += l_size;
+  if ( m_used > m_highwater )
+  {
+    m_highwater = m_used;
+  }
+  return l_block;
+}
+
+
+/*
+ * arena_reset - throws away everything in the arena, along with the sprite
+ *               frames cached in it.
+ */
+
+void arena_reset( void )
+{
+  /* If we've reached new heights, let someone know. */
+  if ( m_highwater > m_reported )
+  {
+    printf( "arena: high water mark now %lu of %d bytes\n",
+            (unsigned long)m_highwater, ARENA_SIZE );
+    m_reported = m_highwater;
+  }
+  m_used = 0;
+
+  /* Nobody must be left holding frames that now point at nothing. */
+  sprite_cache_flush();
+}
+
+
+/*
+ * arena_used - returns how much of the arena is currently allocated.
+ */
+
+uint32_t arena_used( void )
+{
+  return m_used;
+}
+
+
+/*
+ * arena_highwater - returns the most the arena has ever had allocated.
+ */
+
+uint32_t arena_highwater( void )
+{
+  return m_highwater;
+}
+
+
+/* End of arena.cpp */
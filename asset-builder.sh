@@ -19,7 +19,6 @@ cat > assets.h << ENDOFHEADER
 ENDOFHEADER
 
 # Sprites first, which will be any png lurking in the asset folder
-asset_list=()
 for sprite in `ls assets/*.png`
 do
   # Work out the appropriate packed data name
@@ -28,15 +27,13 @@ do
   # Generate the packed data
   echo -n 'const static ' >> assets.h
   $SPRITEBUILDER packed --arrayname m_sprite_$asset_name $sprite >> assets.h
-  
-  # And push this asset into the generated set
-  asset_list+=($asset_name)
 done
 
-# And lastly, put out the sprite lookup table
-echo "static const struct { const char *name; const uint8_t *data; } m_sprites[] = {" >> assets.h
-for asset in ${asset_list[@]}
-do
-  echo "{ \"$asset\", m_sprite_$asset }," >> assets.h
-done
-echo "{ NULL, NULL }};" >> assets.h
+# And lastly, re-encode the sprites into whatever is quickest to draw, along
+# with their collision masks and the metadata table to find it all by.
+python3 `dirname $0`/sprite-encoder.py assets.h > assets.tmp
+cat assets.tmp >> assets.h
+rm -f assets.tmp
+
+# The brick types are built from their definitions, and the sprites above.
+python3 `dirname $0`/sprite-encoder.py --bricks assets/bricks.txt assets.h > bricks.h
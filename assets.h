@@ -47,6 +47,29 @@ uint8_t m_sprite_bat_normal[] = {
     0x15, 0x55, 0x55, 0x54, 0x6a, 0xaa, 0xaa, 0xab, 0x6a, 0xaa, 0xaa, 0xab, 0x3f, 0xff, 0xff, 0xfc
 };
 
+const static 
+uint8_t m_sprite_bat_wide[] = {
+    0x53, 0x50, 0x52, 0x49, 0x54, 0x45, 0x50, 0x4b, // type: spritepk (packed, paletted sprite)
+    0x3c, 0x00, // payload size (60)
+
+    0x18, 0x00, // width (24)
+    0x04, 0x00, // height (4)
+    0x03, 0x00, // cols (3)
+    0x00, 0x00, // rows (0)
+
+    0x03, // format (paletted)
+
+    0x04, // number of palette colours (4)
+//  r     g     b     a
+    0x00, 0x00, 0x00, 0x00,
+    0xe0, 0xe0, 0xe0, 0xff,
+    0xc0, 0xc0, 0xc0, 0xff,
+    0xa0, 0xa0, 0xa0, 0xff,
+
+    0x15, 0x55, 0x55, 0x55, 0x55, 0x54, 0x6a, 0xaa, 0xaa, 0xaa, 0xaa, 0xab, 0x6a, 0xaa, 0xaa, 0xaa,
+    0xaa, 0xab, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc
+};
+
 const static 
 uint8_t m_sprite_brick_orange[] = {
     0x53, 0x50, 0x52, 0x49, 0x54, 0x45, 0x50, 0x4b, // type: spritepk (packed, paletted sprite)
@@ -944,11 +967,763 @@ uint8_t m_sprite_logo[] = {
     0x00, 0x00, 0x00, 0x00, 0x00
 };
 
-static const struct { const char *name; const uint8_t *data; } m_sprites[] = {
-{ "ball", m_sprite_ball },
-{ "bat_normal", m_sprite_bat_normal },
-{ "brick_orange", m_sprite_brick_orange },
-{ "brick_red", m_sprite_brick_red },
-{ "brick_yellow", m_sprite_brick_yellow },
-{ "logo", m_sprite_logo },
-{ NULL, NULL }};
+/* ball: 5x5, 3 bpp packed, SPRITE_RAW (100 bytes) */
+static constexpr
+uint8_t m_sprite_ball_pixels[] = {
+    0x00, 0x00, 0x00, 0x00, 0xcc, 0xcc, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x00, 0x00, 0x00, 0x00, 0xcc, 0xcc, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0xcc, 0xcc, 0xff,
+    0xaa, 0xaa, 0xaa, 0xff, 0x33, 0x33, 0x33, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0xcc, 0xcc, 0xff,
+    0xaa, 0xaa, 0xaa, 0xff, 0x77, 0x77, 0x77, 0xff, 0x33, 0x33, 0x33, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xaa, 0xaa, 0xaa, 0xff, 0x77, 0x77, 0x77, 0xff, 0x33, 0x33, 0x33, 0xff, 0x77, 0x77, 0x77, 0xff,
+    0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x33, 0xff, 0x33, 0x33, 0x33, 0xff, 0x77, 0x77, 0x77, 0xff,
+    0x00, 0x00, 0x00, 0x00
+};
+
+static constexpr
+uint8_t m_sprite_ball_mask[] = {
+    0x70, 0xf8, 0xf8, 0xf8, 0x70
+};
+
+/* bat_normal: 16x4, 2 bpp packed, SPRITE_RAW (256 bytes) */
+static constexpr
+uint8_t m_sprite_bat_normal_pixels[] = {
+    0x00, 0x00, 0x00, 0x00, 0xe0, 0xe0, 0xe0, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xe0, 0xe0, 0xe0, 0xff,
+    0xe0, 0xe0, 0xe0, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xe0, 0xe0, 0xe0, 0xff,
+    0xe0, 0xe0, 0xe0, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xe0, 0xe0, 0xe0, 0xff,
+    0xe0, 0xe0, 0xe0, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0xe0, 0xe0, 0xe0, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc0, 0xc0, 0xc0, 0xff,
+    0xc0, 0xc0, 0xc0, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc0, 0xc0, 0xc0, 0xff,
+    0xc0, 0xc0, 0xc0, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc0, 0xc0, 0xc0, 0xff,
+    0xc0, 0xc0, 0xc0, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xa0, 0xa0, 0xa0, 0xff,
+    0xe0, 0xe0, 0xe0, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc0, 0xc0, 0xc0, 0xff,
+    0xc0, 0xc0, 0xc0, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc0, 0xc0, 0xc0, 0xff,
+    0xc0, 0xc0, 0xc0, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc0, 0xc0, 0xc0, 0xff,
+    0xc0, 0xc0, 0xc0, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xa0, 0xa0, 0xa0, 0xff,
+    0x00, 0x00, 0x00, 0x00, 0xa0, 0xa0, 0xa0, 0xff, 0xa0, 0xa0, 0xa0, 0xff, 0xa0, 0xa0, 0xa0, 0xff,
+    0xa0, 0xa0, 0xa0, 0xff, 0xa0, 0xa0, 0xa0, 0xff, 0xa0, 0xa0, 0xa0, 0xff, 0xa0, 0xa0, 0xa0, 0xff,
+    0xa0, 0xa0, 0xa0, 0xff, 0xa0, 0xa0, 0xa0, 0xff, 0xa0, 0xa0, 0xa0, 0xff, 0xa0, 0xa0, 0xa0, 0xff,
+    0xa0, 0xa0, 0xa0, 0xff, 0xa0, 0xa0, 0xa0, 0xff, 0xa0, 0xa0, 0xa0, 0xff, 0x00, 0x00, 0x00, 0x00
+};
+
+static constexpr
+uint8_t m_sprite_bat_normal_mask[] = {
+    0x7f, 0xfe, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xfe
+};
+
+static constexpr
+uint32_t m_sprite_bat_normal_frames[] = { 0, 32 };
+
+/* bat_wide: 24x4, 2 bpp packed, SPRITE_RAW (384 bytes) */
+static constexpr
+uint8_t m_sprite_bat_wide_pixels[] = {
+    0x00, 0x00, 0x00, 0x00, 0xe0, 0xe0, 0xe0, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xe0, 0xe0, 0xe0, 0xff,
+    0xe0, 0xe0, 0xe0, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xe0, 0xe0, 0xe0, 0xff,
+    0xe0, 0xe0, 0xe0, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xe0, 0xe0, 0xe0, 0xff,
+    0xe0, 0xe0, 0xe0, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xe0, 0xe0, 0xe0, 0xff,
+    0xe0, 0xe0, 0xe0, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xe0, 0xe0, 0xe0, 0xff,
+    0xe0, 0xe0, 0xe0, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0xe0, 0xe0, 0xe0, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0xe0, 0xe0, 0xe0, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc0, 0xc0, 0xc0, 0xff,
+    0xc0, 0xc0, 0xc0, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc0, 0xc0, 0xc0, 0xff,
+    0xc0, 0xc0, 0xc0, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc0, 0xc0, 0xc0, 0xff,
+    0xc0, 0xc0, 0xc0, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc0, 0xc0, 0xc0, 0xff,
+    0xc0, 0xc0, 0xc0, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc0, 0xc0, 0xc0, 0xff,
+    0xc0, 0xc0, 0xc0, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xa0, 0xa0, 0xa0, 0xff,
+    0xe0, 0xe0, 0xe0, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc0, 0xc0, 0xc0, 0xff,
+    0xc0, 0xc0, 0xc0, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc0, 0xc0, 0xc0, 0xff,
+    0xc0, 0xc0, 0xc0, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc0, 0xc0, 0xc0, 0xff,
+    0xc0, 0xc0, 0xc0, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc0, 0xc0, 0xc0, 0xff,
+    0xc0, 0xc0, 0xc0, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc0, 0xc0, 0xc0, 0xff,
+    0xc0, 0xc0, 0xc0, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xc0, 0xc0, 0xc0, 0xff, 0xa0, 0xa0, 0xa0, 0xff,
+    0x00, 0x00, 0x00, 0x00, 0xa0, 0xa0, 0xa0, 0xff, 0xa0, 0xa0, 0xa0, 0xff, 0xa0, 0xa0, 0xa0, 0xff,
+    0xa0, 0xa0, 0xa0, 0xff, 0xa0, 0xa0, 0xa0, 0xff, 0xa0, 0xa0, 0xa0, 0xff, 0xa0, 0xa0, 0xa0, 0xff,
+    0xa0, 0xa0, 0xa0, 0xff, 0xa0, 0xa0, 0xa0, 0xff, 0xa0, 0xa0, 0xa0, 0xff, 0xa0, 0xa0, 0xa0, 0xff,
+    0xa0, 0xa0, 0xa0, 0xff, 0xa0, 0xa0, 0xa0, 0xff, 0xa0, 0xa0, 0xa0, 0xff, 0xa0, 0xa0, 0xa0, 0xff,
+    0xa0, 0xa0, 0xa0, 0xff, 0xa0, 0xa0, 0xa0, 0xff, 0xa0, 0xa0, 0xa0, 0xff, 0xa0, 0xa0, 0xa0, 0xff,
+    0xa0, 0xa0, 0xa0, 0xff, 0xa0, 0xa0, 0xa0, 0xff, 0xa0, 0xa0, 0xa0, 0xff, 0x00, 0x00, 0x00, 0x00
+};
+
+static constexpr
+uint8_t m_sprite_bat_wide_mask[] = {
+    0x7f, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xfe
+};
+
+static constexpr
+uint32_t m_sprite_bat_wide_frames[] = { 0, 32, 64 };
+
+/* brick_orange: 16x8, 2 bpp packed, SPRITE_RAW (512 bytes) */
+static constexpr
+uint8_t m_sprite_brick_orange_pixels[] = {
+    0xff, 0x80, 0x40, 0xff, 0xff, 0x80, 0x40, 0xff, 0xff, 0x80, 0x40, 0xff, 0xff, 0x80, 0x40, 0xff,
+    0xff, 0x80, 0x40, 0xff, 0xff, 0x80, 0x40, 0xff, 0xff, 0x80, 0x40, 0xff, 0xff, 0x80, 0x40, 0xff,
+    0xff, 0x80, 0x40, 0xff, 0xff, 0x80, 0x40, 0xff, 0xff, 0x80, 0x40, 0xff, 0xff, 0x80, 0x40, 0xff,
+    0xff, 0x80, 0x40, 0xff, 0xff, 0x80, 0x40, 0xff, 0xff, 0x80, 0x40, 0xff, 0xff, 0x80, 0x40, 0xff,
+    0xff, 0x80, 0x40, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff,
+    0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff,
+    0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff,
+    0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0x80, 0x40, 0x00, 0xff,
+    0xff, 0x80, 0x40, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff,
+    0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff,
+    0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff,
+    0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0x80, 0x40, 0x00, 0xff,
+    0xff, 0x80, 0x40, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff,
+    0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff,
+    0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff,
+    0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0x80, 0x40, 0x00, 0xff,
+    0xff, 0x80, 0x40, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff,
+    0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff,
+    0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff,
+    0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0x80, 0x40, 0x00, 0xff,
+    0xff, 0x80, 0x40, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff,
+    0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff,
+    0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff,
+    0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0x80, 0x40, 0x00, 0xff,
+    0xff, 0x80, 0x40, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff,
+    0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff,
+    0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff,
+    0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0x80, 0x00, 0xff, 0x80, 0x40, 0x00, 0xff,
+    0xff, 0x80, 0x40, 0xff, 0x80, 0x40, 0x00, 0xff, 0x80, 0x40, 0x00, 0xff, 0x80, 0x40, 0x00, 0xff,
+    0x80, 0x40, 0x00, 0xff, 0x80, 0x40, 0x00, 0xff, 0x80, 0x40, 0x00, 0xff, 0x80, 0x40, 0x00, 0xff,
+    0x80, 0x40, 0x00, 0xff, 0x80, 0x40, 0x00, 0xff, 0x80, 0x40, 0x00, 0xff, 0x80, 0x40, 0x00, 0xff,
+    0x80, 0x40, 0x00, 0xff, 0x80, 0x40, 0x00, 0xff, 0x80, 0x40, 0x00, 0xff, 0x80, 0x40, 0x00, 0xff
+};
+
+static constexpr
+uint8_t m_sprite_brick_orange_mask[] = {
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+};
+
+static constexpr
+uint32_t m_sprite_brick_orange_frames[] = { 0, 32 };
+
+/* brick_red: 16x8, 2 bpp packed, SPRITE_RAW (512 bytes) */
+static constexpr
+uint8_t m_sprite_brick_red_pixels[] = {
+    0xff, 0x80, 0x80, 0xff, 0xff, 0x80, 0x80, 0xff, 0xff, 0x80, 0x80, 0xff, 0xff, 0x80, 0x80, 0xff,
+    0xff, 0x80, 0x80, 0xff, 0xff, 0x80, 0x80, 0xff, 0xff, 0x80, 0x80, 0xff, 0xff, 0x80, 0x80, 0xff,
+    0xff, 0x80, 0x80, 0xff, 0xff, 0x80, 0x80, 0xff, 0xff, 0x80, 0x80, 0xff, 0xff, 0x80, 0x80, 0xff,
+    0xff, 0x80, 0x80, 0xff, 0xff, 0x80, 0x80, 0xff, 0xff, 0x80, 0x80, 0xff, 0xff, 0x80, 0x80, 0xff,
+    0xff, 0x80, 0x80, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
+    0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
+    0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
+    0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xff,
+    0xff, 0x80, 0x80, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
+    0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
+    0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
+    0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xff,
+    0xff, 0x80, 0x80, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
+    0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
+    0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
+    0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xff,
+    0xff, 0x80, 0x80, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
+    0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
+    0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
+    0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xff,
+    0xff, 0x80, 0x80, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
+    0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
+    0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
+    0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xff,
+    0xff, 0x80, 0x80, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
+    0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
+    0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff,
+    0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xff,
+    0xff, 0x80, 0x80, 0xff, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xff,
+    0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xff,
+    0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xff,
+    0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xff
+};
+
+static constexpr
+uint8_t m_sprite_brick_red_mask[] = {
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+};
+
+static constexpr
+uint32_t m_sprite_brick_red_frames[] = { 0, 32 };
+
+/* brick_yellow: 16x8, 2 bpp packed, SPRITE_RAW (512 bytes) */
+static constexpr
+uint8_t m_sprite_brick_yellow_pixels[] = {
+    0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0x80, 0xff,
+    0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0x80, 0xff,
+    0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0x80, 0xff,
+    0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0x80, 0xff,
+    0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
+    0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
+    0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
+    0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0x80, 0x80, 0x00, 0xff,
+    0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
+    0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
+    0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
+    0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0x80, 0x80, 0x00, 0xff,
+    0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
+    0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
+    0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
+    0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0x80, 0x80, 0x00, 0xff,
+    0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
+    0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
+    0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
+    0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0x80, 0x80, 0x00, 0xff,
+    0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
+    0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
+    0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
+    0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0x80, 0x80, 0x00, 0xff,
+    0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
+    0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
+    0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff,
+    0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0x00, 0xff, 0x80, 0x80, 0x00, 0xff,
+    0xff, 0xff, 0x80, 0xff, 0x80, 0x80, 0x00, 0xff, 0x80, 0x80, 0x00, 0xff, 0x80, 0x80, 0x00, 0xff,
+    0x80, 0x80, 0x00, 0xff, 0x80, 0x80, 0x00, 0xff, 0x80, 0x80, 0x00, 0xff, 0x80, 0x80, 0x00, 0xff,
+    0x80, 0x80, 0x00, 0xff, 0x80, 0x80, 0x00, 0xff, 0x80, 0x80, 0x00, 0xff, 0x80, 0x80, 0x00, 0xff,
+    0x80, 0x80, 0x00, 0xff, 0x80, 0x80, 0x00, 0xff, 0x80, 0x80, 0x00, 0xff, 0x80, 0x80, 0x00, 0xff
+};
+
+static constexpr
+uint8_t m_sprite_brick_yellow_mask[] = {
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+};
+
+static constexpr
+uint32_t m_sprite_brick_yellow_frames[] = { 0, 32 };
+
+/* logo: 150x90, 7 bpp packed, SPRITE_RLE (6667 bytes) */
+static constexpr
+uint8_t m_sprite_logo_pixels[] = {
+    0xff, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x97, 0xfb, 0x01, 0xfb, 0xf2, 0x36, 0x38, 0x01, 0xfb,
+    0xf2, 0x36, 0x55, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x98, 0xfa, 0x01, 0xfb, 0xf2, 0x36, 0x38, 0x01,
+    0xfb, 0xf2, 0x36, 0xe2, 0x01, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xaa, 0x01, 0xfb,
+    0xf2, 0x36, 0x38, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x96, 0xfa, 0x01, 0xfb, 0xf2, 0x36, 0x38, 0x01,
+    0xfb, 0xf2, 0x36, 0xe2, 0x02, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x01, 0xfb,
+    0xf2, 0x36, 0xaa, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x95, 0xfa, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x01,
+    0xfb, 0xf2, 0x36, 0xaa, 0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x02, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb,
+    0xf2, 0x36, 0xe2, 0x01, 0xfb, 0xf2, 0x36, 0x55, 0x95, 0xfb, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x01,
+    0xfb, 0xf2, 0x36, 0x55, 0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x02, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb,
+    0xf2, 0x36, 0xc6, 0x01, 0xfb, 0xf2, 0x36, 0x38, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x93, 0xfd, 0x01,
+    0xfb, 0xf2, 0x36, 0x55, 0x03, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x01, 0xfb,
+    0xf2, 0x36, 0x8d, 0x93, 0xfd, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x01, 0xfb, 0xf2, 0x36, 0xaa, 0x03,
+    0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xc6, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x92, 0x93,
+    0x0b, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x01, 0xfb, 0xf2, 0x36, 0x71,
+    0x03, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xaa, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x91,
+    0x90, 0x10, 0xff, 0xff, 0xff, 0xff, 0x8d, 0x06, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x01, 0xfb, 0xf2,
+    0x36, 0x03, 0x01, 0xfb, 0xf2, 0x36, 0x35, 0x01, 0xfb, 0xf2, 0x36, 0x3d, 0x01, 0xfb, 0xf2, 0x36,
+    0x1f, 0x88, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x01, 0xfb, 0xf2, 0x36, 0xaa, 0x03, 0xfb, 0xf2, 0x36,
+    0xff, 0x01, 0xfb, 0xf2, 0x36, 0x71, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x90, 0x8e, 0x13, 0xff, 0xff,
+    0xff, 0xff, 0x8b, 0x09, 0xff, 0xff, 0xff, 0xff, 0xbe, 0x01, 0xfb, 0xf2, 0x36, 0x1f, 0x01, 0xfb,
+    0xf2, 0x36, 0x8a, 0x01, 0xfb, 0xf2, 0x36, 0x85, 0x01, 0xfb, 0xf2, 0x36, 0x51, 0x89, 0x01, 0xfb,
+    0xf2, 0x36, 0x55, 0x03, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xaa, 0x01, 0xfb, 0xf2,
+    0x36, 0x55, 0x90, 0x8b, 0x0a, 0xff, 0xff, 0xff, 0xff, 0x88, 0x04, 0xff, 0xff, 0xff, 0xff, 0x89,
+    0x0b, 0xff, 0xff, 0xff, 0xff, 0xbe, 0x01, 0xfb, 0xf2, 0x36, 0x55, 0x01, 0xfb, 0xf2, 0x36, 0xff,
+    0x01, 0xfb, 0xf2, 0x36, 0xdf, 0x01, 0xfb, 0xf2, 0x36, 0xaa, 0x8a, 0x01, 0xfb, 0xf2, 0x36, 0x71,
+    0x01, 0xfb, 0xf2, 0x36, 0xc6, 0x02, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x01,
+    0xfb, 0xf2, 0x36, 0x38, 0x8f, 0x8a, 0x08, 0xff, 0xff, 0xff, 0xff, 0x8c, 0x04, 0xff, 0xff, 0xff,
+    0xff, 0x88, 0x05, 0xff, 0xff, 0xff, 0xff, 0x83, 0x04, 0xff, 0xff, 0xff, 0xff, 0xbd, 0x01, 0xfb,
+    0xf2, 0x36, 0x55, 0x01, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x01, 0xfb, 0xf2,
+    0x36, 0xaa, 0x8a, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x01, 0xfb, 0xf2, 0x36, 0x55, 0x01, 0xfb, 0xf2,
+    0x36, 0xe2, 0x02, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0x8d, 0x8f, 0x8a, 0x06, 0xff,
+    0xff, 0xff, 0xff, 0x8e, 0x04, 0xff, 0xff, 0xff, 0xff, 0x87, 0x04, 0xff, 0xff, 0xff, 0xff, 0x86,
+    0x03, 0xff, 0xff, 0xff, 0xff, 0xbd, 0x01, 0xfb, 0xf2, 0x36, 0x55, 0x02, 0xfb, 0xf2, 0x36, 0xff,
+    0x01, 0xfb, 0xf2, 0x36, 0xaa, 0x8b, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x01, 0xfb, 0xf2, 0x36, 0xc6,
+    0x02, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xc6, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x8e,
+    0x8b, 0x01, 0xff, 0xff, 0xff, 0xff, 0x93, 0x04, 0xff, 0xff, 0xff, 0xff, 0x86, 0x03, 0xff, 0xff,
+    0xff, 0xff, 0x87, 0x03, 0xff, 0xff, 0xff, 0xff, 0xbd, 0x01, 0xfb, 0xf2, 0x36, 0x55, 0x02, 0xfb,
+    0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xc0, 0x01, 0xfb, 0xf2, 0x36, 0x26, 0x01, 0xfb, 0xf2,
+    0x36, 0x01, 0x8a, 0x01, 0xfb, 0xf2, 0x36, 0x71, 0x03, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2,
+    0x36, 0x55, 0x8e, 0xa0, 0x03, 0xff, 0xff, 0xff, 0xff, 0x85, 0x04, 0xff, 0xff, 0xff, 0xff, 0x87,
+    0x04, 0xff, 0xff, 0xff, 0xff, 0xbc, 0x01, 0xfb, 0xf2, 0x36, 0x55, 0x02, 0xfb, 0xf2, 0x36, 0xff,
+    0x01, 0xfb, 0xf2, 0x36, 0xd9, 0x01, 0xfb, 0xf2, 0x36, 0x4a, 0x01, 0xfb, 0xf2, 0x36, 0x05, 0x8a,
+    0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x01, 0xfb, 0xf2, 0x36, 0xc6, 0x02, 0xfb, 0xf2, 0x36, 0xff, 0x01,
+    0xfb, 0xf2, 0x36, 0x8d, 0x01, 0xfb, 0xf2, 0x36, 0x38, 0x8d, 0xa0, 0x03, 0xff, 0xff, 0xff, 0xff,
+    0x85, 0x04, 0xff, 0xff, 0xff, 0xff, 0x87, 0x04, 0xff, 0xff, 0xff, 0xff, 0xb2, 0x01, 0xfb, 0xf2,
+    0x36, 0x0f, 0x01, 0xfb, 0xf2, 0x36, 0x06, 0x88, 0x01, 0xfb, 0xf2, 0x36, 0x38, 0x01, 0xfb, 0xf2,
+    0x36, 0xe2, 0x01, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xdf, 0x01, 0xfb, 0xf2, 0x36,
+    0x56, 0x01, 0xfb, 0xf2, 0x36, 0x07, 0x8b, 0x01, 0xfb, 0xf2, 0x36, 0x8d, 0x01, 0xfb, 0xf2, 0x36,
+    0xe2, 0x01, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xc6, 0x01, 0xfb, 0xf2, 0x36, 0x71,
+    0x8d, 0xa0, 0x03, 0xff, 0xff, 0xff, 0xff, 0x91, 0x03, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x01, 0xfb,
+    0xf2, 0x36, 0x1c, 0x02, 0xfb, 0xf2, 0x36, 0x8d, 0x01, 0xfb, 0xf2, 0x36, 0x67, 0x01, 0xfb, 0xf2,
+    0x36, 0x1c, 0x88, 0x01, 0xfb, 0xf2, 0x36, 0xaa, 0x01, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2,
+    0x36, 0xec, 0x01, 0xfb, 0xf2, 0x36, 0x6f, 0x01, 0xfb, 0xf2, 0x36, 0x0f, 0x01, 0xfb, 0xf2, 0x36,
+    0x02, 0x8a, 0x01, 0xfb, 0xf2, 0x36, 0x38, 0x01, 0xfb, 0xf2, 0x36, 0x8d, 0x02, 0xfb, 0xf2, 0x36,
+    0xff, 0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x01, 0xfb, 0xf2, 0x36, 0x38, 0x8c, 0x9e, 0x05, 0xff, 0xff,
+    0xff, 0xff, 0x91, 0x03, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x01, 0xfb, 0xf2, 0x36, 0x55, 0x04, 0xfb,
+    0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0x71, 0x01, 0xfb, 0xf2, 0x36, 0x55, 0x01, 0xfb, 0xf2,
+    0x36, 0x1c, 0x85, 0x01, 0xfb, 0xf2, 0x36, 0xaa, 0x02, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2,
+    0x36, 0x96, 0x01, 0xfb, 0xf2, 0x36, 0x12, 0x8c, 0x01, 0xfb, 0xf2, 0x36, 0x38, 0x01, 0xfb, 0xf2,
+    0x36, 0xe2, 0x02, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0x55, 0x8c, 0x9d, 0x06, 0xff,
+    0xff, 0xff, 0xff, 0x91, 0x03, 0xff, 0xff, 0xff, 0xff, 0xb0, 0x01, 0xfb, 0xf2, 0x36, 0x38, 0x01,
+    0xfb, 0xf2, 0x36, 0xe2, 0x03, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xc6, 0x01, 0xfb,
+    0xf2, 0x36, 0xaa, 0x01, 0xfb, 0xf2, 0x36, 0x55, 0x85, 0x01, 0xfb, 0xf2, 0x36, 0x8d, 0x02, 0xfb,
+    0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xa3, 0x01, 0xfb, 0xf2, 0x36, 0x19, 0x8c, 0x01, 0xfb,
+    0xf2, 0x36, 0x1c, 0x01, 0xfb, 0xf2, 0x36, 0xaa, 0x01, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2,
+    0x36, 0xe2, 0x01, 0xfb, 0xf2, 0x36, 0x38, 0x8c, 0x9b, 0x06, 0xff, 0xff, 0xff, 0xff, 0x93, 0x03,
+    0xff, 0xff, 0xff, 0xff, 0xaf, 0x01, 0xfb, 0xf2, 0x36, 0x03, 0x01, 0xfb, 0xf2, 0x36, 0x0c, 0x01,
+    0xfb, 0xf2, 0x36, 0x5e, 0x01, 0xfb, 0xf2, 0x36, 0xc6, 0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x03, 0xfb,
+    0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x01, 0xfb, 0xf2, 0x36, 0x71, 0x01, 0xfb, 0xf2,
+    0x36, 0x38, 0x83, 0x01, 0xfb, 0xf2, 0x36, 0x55, 0x02, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2,
+    0x36, 0xbc, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x8d, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x01, 0xfb, 0xf2,
+    0x36, 0x55, 0x01, 0xfb, 0xf2, 0x36, 0x38, 0x8d, 0x95, 0x0b, 0xff, 0xff, 0xff, 0xff, 0x93, 0x04,
+    0xff, 0xff, 0xff, 0xff, 0xb2, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x01, 0xfb, 0xf2, 0x36, 0x38, 0x01,
+    0xfb, 0xf2, 0x36, 0x8d, 0x04, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x01, 0xfb,
+    0xf2, 0x36, 0x55, 0x82, 0x01, 0xfb, 0xf2, 0x36, 0x55, 0x02, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb,
+    0xf2, 0x36, 0xbc, 0x01, 0xfb, 0xf2, 0x36, 0x15, 0x01, 0xfb, 0xf2, 0x36, 0x03, 0x9c, 0x94, 0x0d,
+    0xff, 0xff, 0xff, 0xff, 0x92, 0x03, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x01, 0xfb, 0xf2, 0x36, 0x38,
+    0x05, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xaa, 0x01, 0xfb, 0xf2, 0x36, 0x55, 0x01,
+    0xfb, 0xf2, 0x36, 0x38, 0x01, 0xfb, 0xf2, 0x36, 0x55, 0x02, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb,
+    0xf2, 0x36, 0xb3, 0x01, 0xfb, 0xf2, 0x36, 0x1a, 0x01, 0xfb, 0xf2, 0x36, 0x07, 0x9c, 0x93, 0x0f,
+    0xff, 0xff, 0xff, 0xff, 0x90, 0x04, 0xff, 0xff, 0xff, 0xff, 0xb7, 0x01, 0xfb, 0xf2, 0x36, 0x1c,
+    0x01, 0xfb, 0xf2, 0x36, 0x8d, 0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x03, 0xfb, 0xf2, 0x36, 0xff, 0x01,
+    0xfb, 0xf2, 0x36, 0xe2, 0x01, 0xfb, 0xf2, 0x36, 0xc6, 0x02, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb,
+    0xf2, 0x36, 0xc6, 0x01, 0xfb, 0xf2, 0x36, 0x2f, 0x01, 0xfb, 0xf2, 0x36, 0x09, 0x9c, 0x94, 0x03,
+    0xff, 0xff, 0xff, 0xff, 0x87, 0x05, 0xff, 0xff, 0xff, 0xff, 0x8f, 0x03, 0xff, 0xff, 0xff, 0xff,
+    0xba, 0x01, 0xfb, 0xf2, 0x36, 0x55, 0x01, 0xfb, 0xf2, 0x36, 0xaa, 0x07, 0xfb, 0xf2, 0x36, 0xff,
+    0x01, 0xfb, 0xf2, 0x36, 0x55, 0x01, 0xfb, 0xf2, 0x36, 0x19, 0x9c, 0x9f, 0x04, 0xff, 0xff, 0xff,
+    0xff, 0x8e, 0x04, 0xff, 0xff, 0xff, 0xff, 0xba, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x01, 0xfb, 0xf2,
+    0x36, 0x55, 0x01, 0xfb, 0xf2, 0x36, 0xaa, 0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x05, 0xfb, 0xf2, 0x36,
+    0xff, 0x01, 0xfb, 0xf2, 0x36, 0x55, 0x81, 0x01, 0xfb, 0xf2, 0x36, 0x03, 0x9b, 0xa0, 0x04, 0xff,
+    0xff, 0xff, 0xff, 0x8d, 0x04, 0xff, 0xff, 0xff, 0xff, 0xbd, 0x01, 0xfb, 0xf2, 0x36, 0x55, 0x01,
+    0xfb, 0xf2, 0x36, 0x8d, 0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x03, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb,
+    0xf2, 0x36, 0xc6, 0x01, 0xfb, 0xf2, 0x36, 0x8d, 0x01, 0xfb, 0xf2, 0x36, 0x38, 0x9b, 0xa1, 0x03,
+    0xff, 0xff, 0xff, 0xff, 0x8c, 0x04, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x01, 0xfb, 0xf2, 0x36, 0x55,
+    0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x04, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x01,
+    0xfb, 0xf2, 0x36, 0x71, 0x01, 0xfb, 0xf2, 0x36, 0x38, 0x8d, 0x01, 0xfb, 0xf2, 0x36, 0x38, 0x01,
+    0xfb, 0xf2, 0x36, 0x55, 0x01, 0xfb, 0xf2, 0x36, 0x8d, 0x02, 0xfb, 0xf2, 0x36, 0xaa, 0x01, 0xfb,
+    0xf2, 0x36, 0x55, 0x86, 0xa1, 0x03, 0xff, 0xff, 0xff, 0xff, 0x8c, 0x03, 0xff, 0xff, 0xff, 0xff,
+    0xa6, 0x01, 0xfb, 0xf2, 0x36, 0x38, 0x05, 0xfb, 0xf2, 0x36, 0x55, 0x01, 0xfb, 0xf2, 0x36, 0x1c,
+    0x94, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x01, 0xfb, 0xf2, 0x36, 0xc6, 0x05, 0xfb, 0xf2, 0x36, 0xff,
+    0x01, 0xfb, 0xf2, 0x36, 0xc6, 0x01, 0xfb, 0xf2, 0x36, 0x8d, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x8b,
+    0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x01, 0xfb, 0xf2, 0x36, 0x8d, 0x01, 0xfb, 0xf2, 0x36, 0xaa, 0x01,
+    0xfb, 0xf2, 0x36, 0xe2, 0x02, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xaa, 0x01, 0xfb,
+    0xf2, 0x36, 0x1c, 0x85, 0xa1, 0x03, 0xff, 0xff, 0xff, 0xff, 0x8b, 0x04, 0xff, 0xff, 0xff, 0xff,
+    0xa3, 0x01, 0xfb, 0xf2, 0x36, 0x38, 0x01, 0xfb, 0xf2, 0x36, 0x71, 0x01, 0xfb, 0xf2, 0x36, 0x8d,
+    0x07, 0xfb, 0xf2, 0x36, 0xff, 0x03, 0xfb, 0xf2, 0x36, 0xaa, 0x01, 0xfb, 0xf2, 0x36, 0x8d, 0x01,
+    0xfb, 0xf2, 0x36, 0x71, 0x01, 0xfb, 0xf2, 0x36, 0x38, 0x8f, 0x01, 0xfb, 0xf2, 0x36, 0x71, 0x01,
+    0xfb, 0xf2, 0x36, 0xc6, 0x06, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xc6, 0x01, 0xfb,
+    0xf2, 0x36, 0x55, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x89, 0x01, 0xfb, 0xf2, 0x36, 0x71, 0x06, 0xfb,
+    0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0x71, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x84, 0xa1, 0x03,
+    0xff, 0xff, 0xff, 0xff, 0x8a, 0x04, 0xff, 0xff, 0xff, 0xff, 0xa2, 0x01, 0xfb, 0xf2, 0x36, 0x55,
+    0x01, 0xfb, 0xf2, 0x36, 0x8d, 0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x0e, 0xfb, 0xf2, 0x36, 0xff, 0x01,
+    0xfb, 0xf2, 0x36, 0xe2, 0x01, 0xfb, 0xf2, 0x36, 0x8d, 0x01, 0xfb, 0xf2, 0x36, 0x71, 0x01, 0xfb,
+    0xf2, 0x36, 0x1c, 0x8c, 0x01, 0xfb, 0xf2, 0x36, 0x55, 0x01, 0xfb, 0xf2, 0x36, 0xaa, 0x02, 0xfb,
+    0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0x8d, 0x01, 0xfb, 0xf2, 0x36, 0xaa, 0x03, 0xfb, 0xf2,
+    0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x01, 0xfb, 0xf2, 0x36, 0xaa, 0x01, 0xfb, 0xf2, 0x36,
+    0x1c, 0x88, 0x01, 0xfb, 0xf2, 0x36, 0xaa, 0x06, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36,
+    0xaa, 0x01, 0xfb, 0xf2, 0x36, 0x55, 0x84, 0xa1, 0x04, 0xff, 0xff, 0xff, 0xff, 0x89, 0x04, 0xff,
+    0xff, 0xff, 0xff, 0xa2, 0x01, 0xfb, 0xf2, 0x36, 0x8d, 0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x05, 0xfb,
+    0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xc6, 0x01, 0xfb, 0xf2, 0x36, 0xaa, 0x01, 0xfb, 0xf2,
+    0x36, 0xc6, 0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x07, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36,
+    0xe2, 0x01, 0xfb, 0xf2, 0x36, 0xc6, 0x01, 0xfb, 0xf2, 0x36, 0x55, 0x8c, 0x01, 0xfb, 0xf2, 0x36,
+    0x55, 0x01, 0xfb, 0xf2, 0x36, 0xaa, 0x01, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xaa,
+    0x02, 0xfb, 0xf2, 0x36, 0x55, 0x01, 0xfb, 0xf2, 0x36, 0xc6, 0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x02,
+    0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x01, 0xfb, 0xf2, 0x36, 0x55, 0x88, 0x01,
+    0xfb, 0xf2, 0x36, 0xaa, 0x06, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xaa, 0x01, 0xfb,
+    0xf2, 0x36, 0x55, 0x84, 0xa1, 0x04, 0xff, 0xff, 0xff, 0xff, 0x88, 0x04, 0xff, 0xff, 0xff, 0xff,
+    0xa2, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x01, 0xfb, 0xf2, 0x36, 0xc6, 0x04, 0xfb, 0xf2, 0x36, 0xff,
+    0x01, 0xfb, 0xf2, 0x36, 0x71, 0x01, 0xfb, 0xf2, 0x36, 0x38, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x81,
+    0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x01, 0xfb, 0xf2, 0x36, 0x38, 0x01, 0xfb, 0xf2, 0x36, 0x55, 0x01,
+    0xfb, 0xf2, 0x36, 0x8d, 0x01, 0xfb, 0xf2, 0x36, 0xaa, 0x01, 0xfb, 0xf2, 0x36, 0x8d, 0x05, 0xfb,
+    0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x01, 0xfb, 0xf2, 0x36, 0x55, 0x01, 0xfb, 0xf2,
+    0x36, 0x1c, 0x8a, 0x01, 0xfb, 0xf2, 0x36, 0x55, 0x01, 0xfb, 0xf2, 0x36, 0xaa, 0x01, 0xfb, 0xf2,
+    0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xc6, 0x01, 0xfb, 0xf2, 0x36, 0x71, 0x81, 0x01, 0xfb, 0xf2,
+    0x36, 0x1c, 0x01, 0xfb, 0xf2, 0x36, 0x55, 0x03, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36,
+    0xe2, 0x01, 0xfb, 0xf2, 0x36, 0x55, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x02, 0xfb, 0xf2, 0x36, 0x03,
+    0x84, 0x01, 0xfb, 0xf2, 0x36, 0xaa, 0x06, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xaa,
+    0x01, 0xfb, 0xf2, 0x36, 0x55, 0x84, 0xa2, 0x03, 0xff, 0xff, 0xff, 0xff, 0x87, 0x04, 0xff, 0xff,
+    0xff, 0xff, 0xa3, 0x01, 0xfb, 0xf2, 0x36, 0x55, 0x03, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2,
+    0x36, 0x55, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x8b, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x01, 0xfb, 0xf2,
+    0x36, 0x8d, 0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x02, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36,
+    0xe2, 0x01, 0xfb, 0xf2, 0x36, 0xaa, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x89, 0x01, 0xfb, 0xf2, 0x36,
+    0x38, 0x01, 0xfb, 0xf2, 0x36, 0x8d, 0x02, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xaa,
+    0x81, 0x01, 0xfb, 0xf2, 0x36, 0x03, 0x01, 0xfb, 0xf2, 0x36, 0x0f, 0x01, 0xfb, 0xf2, 0x36, 0x64,
+    0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x02, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x01,
+    0xfb, 0xf2, 0x36, 0xc6, 0x01, 0xfb, 0xf2, 0x36, 0x7d, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x84, 0x01,
+    0xfb, 0xf2, 0x36, 0x71, 0x05, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xc6, 0x01, 0xfb,
+    0xf2, 0x36, 0x55, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x84, 0xa1, 0x04, 0xff, 0xff, 0xff, 0xff, 0x87,
+    0x04, 0xff, 0xff, 0xff, 0xff, 0x95, 0x01, 0xfb, 0xf2, 0x36, 0x09, 0x8d, 0x01, 0xfb, 0xf2, 0x36,
+    0x55, 0x02, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xc6, 0x01, 0xfb, 0xf2, 0x36, 0x1c,
+    0x8d, 0x01, 0xfb, 0xf2, 0x36, 0x38, 0x01, 0xfb, 0xf2, 0x36, 0xaa, 0x01, 0xfb, 0xf2, 0x36, 0xe2,
+    0x02, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x01, 0xfb, 0xf2, 0x36, 0x55, 0x89,
+    0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x01, 0xfb, 0xf2, 0x36, 0x71, 0x02, 0xfb, 0xf2, 0x36, 0xff, 0x01,
+    0xfb, 0xf2, 0x36, 0xaa, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x81, 0x01, 0xfb, 0xf2, 0x36, 0x03, 0x01,
+    0xfb, 0xf2, 0x36, 0x22, 0x01, 0xfb, 0xf2, 0x36, 0xaa, 0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x03, 0xfb,
+    0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x01, 0xfb, 0xf2, 0x36, 0x38, 0x84, 0x01, 0xfb,
+    0xf2, 0x36, 0x38, 0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x03, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2,
+    0x36, 0xe2, 0x01, 0xfb, 0xf2, 0x36, 0x71, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x85, 0x8d, 0x04, 0xff,
+    0xff, 0xff, 0xff, 0x90, 0x04, 0xff, 0xff, 0xff, 0xff, 0x85, 0x05, 0xff, 0xff, 0xff, 0xff, 0x89,
+    0x04, 0xff, 0xff, 0xff, 0xff, 0x87, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x01, 0xfb, 0xf2, 0x36, 0x8d,
+    0x01, 0xfb, 0xf2, 0x36, 0x83, 0x01, 0xfb, 0xf2, 0x36, 0x55, 0x8c, 0x01, 0xfb, 0xf2, 0x36, 0x55,
+    0x02, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xaa, 0x8f, 0x01, 0xfb, 0xf2, 0x36, 0x1c,
+    0x01, 0xfb, 0xf2, 0x36, 0x55, 0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x02, 0xfb, 0xf2, 0x36, 0xff, 0x01,
+    0xfb, 0xf2, 0x36, 0xe2, 0x01, 0xfb, 0xf2, 0x36, 0x38, 0x89, 0x01, 0xfb, 0xf2, 0x36, 0x55, 0x02,
+    0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xaa, 0x01, 0xfb, 0xf2, 0x36, 0x22, 0x83, 0x01,
+    0xfb, 0xf2, 0x36, 0x1c, 0x01, 0xfb, 0xf2, 0x36, 0x38, 0x04, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb,
+    0xf2, 0x36, 0x55, 0x85, 0x01, 0xfb, 0xf2, 0x36, 0x38, 0x03, 0xfb, 0xf2, 0x36, 0x55, 0x01, 0xfb,
+    0xf2, 0x36, 0x38, 0x87, 0x8d, 0x07, 0xff, 0xff, 0xff, 0xff, 0x8d, 0x03, 0xff, 0xff, 0xff, 0xff,
+    0x86, 0x04, 0xff, 0xff, 0xff, 0xff, 0x82, 0x0e, 0xff, 0xff, 0xff, 0xff, 0x85, 0x01, 0xfb, 0xf2,
+    0x36, 0x55, 0x01, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xdc, 0x01, 0xfb, 0xf2, 0x36,
+    0xaa, 0x8c, 0x01, 0xfb, 0xf2, 0x36, 0x55, 0x02, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36,
+    0xc6, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x90, 0x01, 0xfb, 0xf2, 0x36, 0x55, 0x03, 0xfb, 0xf2, 0x36,
+    0xff, 0x01, 0xfb, 0xf2, 0x36, 0x8d, 0x01, 0xfb, 0xf2, 0x36, 0x38, 0x88, 0x01, 0xfb, 0xf2, 0x36,
+    0x55, 0x02, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x01, 0xfb, 0xf2, 0x36, 0x38,
+    0x85, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x01, 0xfb, 0xf2, 0x36, 0x71, 0x01, 0xfb, 0xf2, 0x36, 0x8d,
+    0x01, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x91, 0x8e, 0x07, 0xff, 0xff, 0xff,
+    0xff, 0x8b, 0x04, 0xff, 0xff, 0xff, 0xff, 0x86, 0x14, 0xff, 0xff, 0xff, 0xff, 0x85, 0x01, 0xfb,
+    0xf2, 0x36, 0x55, 0x02, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xaa, 0x8c, 0x01, 0xfb,
+    0xf2, 0x36, 0x55, 0x02, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x01, 0xfb, 0xf2,
+    0x36, 0x38, 0x90, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x01, 0xfb, 0xf2, 0x36, 0xaa, 0x02, 0xfb, 0xf2,
+    0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xc6, 0x01, 0xfb, 0xf2, 0x36, 0x71, 0x88, 0x01, 0xfb, 0xf2,
+    0x36, 0x55, 0x03, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0x55, 0x86, 0x01, 0xfb, 0xf2,
+    0x36, 0x1c, 0x02, 0xfb, 0xf2, 0x36, 0x38, 0x92, 0x8f, 0x0a, 0xff, 0xff, 0xff, 0xff, 0x86, 0x05,
+    0xff, 0xff, 0xff, 0xff, 0x85, 0x10, 0xff, 0xff, 0xff, 0xff, 0x81, 0x05, 0xff, 0xff, 0xff, 0xff,
+    0x84, 0x01, 0xfb, 0xf2, 0x36, 0x55, 0x02, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xc6,
+    0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x8b, 0x01, 0xfb, 0xf2, 0x36, 0x38, 0x01, 0xfb, 0xf2, 0x36, 0xe2,
+    0x02, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0x71, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x90,
+    0x01, 0xfb, 0xf2, 0x36, 0x38, 0x01, 0xfb, 0xf2, 0x36, 0x8d, 0x02, 0xfb, 0xf2, 0x36, 0xff, 0x01,
+    0xfb, 0xf2, 0x36, 0xaa, 0x88, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x01, 0xfb, 0xf2, 0x36, 0xc6, 0x02,
+    0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0x55, 0x9b, 0x92, 0x11, 0xff, 0xff, 0xff, 0xff,
+    0x86, 0x08, 0xff, 0xff, 0xff, 0xff, 0x8b, 0x02, 0xff, 0xff, 0xff, 0xff, 0x85, 0x01, 0xfb, 0xf2,
+    0x36, 0x38, 0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x02, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36,
+    0x71, 0x8c, 0x01, 0xfb, 0xf2, 0x36, 0x8d, 0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x01, 0xfb, 0xf2, 0x36,
+    0xff, 0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x01, 0xfb, 0xf2, 0x36, 0x8d, 0x91, 0x01, 0xfb, 0xf2, 0x36,
+    0x55, 0x02, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x01, 0xfb, 0xf2, 0x36, 0x38,
+    0x88, 0x01, 0xfb, 0xf2, 0x36, 0xaa, 0x02, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0x55,
+    0x9b, 0x94, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x87, 0x03, 0xff, 0xff, 0xff, 0xff, 0x96, 0x01, 0xfb,
+    0xf2, 0x36, 0x1c, 0x01, 0xfb, 0xf2, 0x36, 0xc6, 0x02, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2,
+    0x36, 0x8d, 0x8c, 0x01, 0xfb, 0xf2, 0x36, 0x71, 0x01, 0xfb, 0xf2, 0x36, 0xc6, 0x02, 0xfb, 0xf2,
+    0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xc6, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x90, 0x01, 0xfb, 0xf2,
+    0x36, 0x55, 0x03, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0x55, 0x88, 0x01, 0xfb, 0xf2,
+    0x36, 0xaa, 0x02, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0x55, 0x9b, 0x97, 0x09, 0xff,
+    0xff, 0xff, 0xff, 0x93, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x01, 0xfb, 0xf2, 0x36, 0x38, 0x02, 0xfb,
+    0xf2, 0x36, 0x55, 0x01, 0xfb, 0xf2, 0x36, 0x71, 0x01, 0xfb, 0xf2, 0x36, 0xa0, 0x02, 0xfb, 0xf2,
+    0x36, 0xaa, 0x01, 0xfb, 0xf2, 0x36, 0x8d, 0x88, 0x01, 0xfb, 0xf2, 0x36, 0x8d, 0x02, 0xfb, 0xf2,
+    0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xc6, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x8b, 0x01, 0xfb, 0xf2,
+    0x36, 0x1c, 0x01, 0xfb, 0xf2, 0x36, 0x55, 0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x02, 0xfb, 0xf2, 0x36,
+    0xff, 0x01, 0xfb, 0xf2, 0x36, 0x71, 0x90, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x01, 0xfb, 0xf2, 0x36,
+    0xc6, 0x02, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0x55, 0x88, 0x01, 0xfb, 0xf2, 0x36,
+    0xaa, 0x02, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0x55, 0x9b, 0xb2, 0x01, 0xfb, 0xf2,
+    0x36, 0x55, 0x01, 0xfb, 0xf2, 0x36, 0xc6, 0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x07, 0xfb, 0xf2, 0x36,
+    0xff, 0x01, 0xfb, 0xf2, 0x36, 0xaa, 0x87, 0x01, 0xfb, 0xf2, 0x36, 0x55, 0x03, 0xfb, 0xf2, 0x36,
+    0xff, 0x01, 0xfb, 0xf2, 0x36, 0x55, 0x8d, 0x01, 0xfb, 0xf2, 0x36, 0x8d, 0x02, 0xfb, 0xf2, 0x36,
+    0xff, 0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x01, 0xfb, 0xf2, 0x36, 0x38, 0x90, 0x01, 0xfb, 0xf2, 0x36,
+    0xaa, 0x02, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0x55, 0x88, 0x01, 0xfb, 0xf2, 0x36,
+    0xaa, 0x02, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0x55, 0x9b, 0xb0, 0x01, 0xfb, 0xf2,
+    0x36, 0x38, 0x01, 0xfb, 0xf2, 0x36, 0x55, 0x01, 0xfb, 0xf2, 0x36, 0xaa, 0x05, 0xfb, 0xf2, 0x36,
+    0xff, 0x01, 0xfb, 0xf2, 0x36, 0xf5, 0x03, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xe2,
+    0x01, 0xfb, 0xf2, 0x36, 0x9d, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x85, 0x01, 0xfb, 0xf2, 0x36, 0x38,
+    0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x02, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0x71, 0x01,
+    0xfb, 0xf2, 0x36, 0x1c, 0x8c, 0x01, 0xfb, 0xf2, 0x36, 0x71, 0x03, 0xfb, 0xf2, 0x36, 0xff, 0x01,
+    0xfb, 0xf2, 0x36, 0x71, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x8f, 0x01, 0xfb, 0xf2, 0x36, 0xaa, 0x02,
+    0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0x71, 0x88, 0x01, 0xfb, 0xf2, 0x36, 0xaa, 0x02,
+    0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0x55, 0x9b, 0xae, 0x01, 0xfb, 0xf2, 0x36, 0x1c,
+    0x01, 0xfb, 0xf2, 0x36, 0x71, 0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x04, 0xfb, 0xf2, 0x36, 0xff, 0x01,
+    0xfb, 0xf2, 0x36, 0xe2, 0x02, 0xfb, 0xf2, 0x36, 0xaa, 0x01, 0xfb, 0xf2, 0x36, 0x86, 0x01, 0xfb,
+    0xf2, 0x36, 0x7d, 0x01, 0xfb, 0xf2, 0x36, 0xa3, 0x03, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2,
+    0x36, 0x8d, 0x86, 0x01, 0xfb, 0xf2, 0x36, 0xaa, 0x02, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2,
+    0x36, 0xc6, 0x01, 0xfb, 0xf2, 0x36, 0x71, 0x8c, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x01, 0xfb, 0xf2,
+    0x36, 0xaa, 0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x01, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36,
+    0xe2, 0x01, 0xfb, 0xf2, 0x36, 0x8d, 0x8f, 0x01, 0xfb, 0xf2, 0x36, 0x8d, 0x02, 0xfb, 0xf2, 0x36,
+    0xff, 0x01, 0xfb, 0xf2, 0x36, 0xaa, 0x88, 0x01, 0xfb, 0xf2, 0x36, 0x8d, 0x01, 0xfb, 0xf2, 0x36,
+    0xff, 0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x01, 0xfb, 0xf2, 0x36, 0x38, 0x9b, 0xad, 0x01, 0xfb, 0xf2,
+    0x36, 0x55, 0x01, 0xfb, 0xf2, 0x36, 0xaa, 0x04, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36,
+    0xb9, 0x01, 0xfb, 0xf2, 0x36, 0x7d, 0x01, 0xfb, 0xf2, 0x36, 0x32, 0x01, 0xfb, 0xf2, 0x36, 0x16,
+    0x01, 0xfb, 0xf2, 0x36, 0x09, 0x81, 0x01, 0xfb, 0xf2, 0x36, 0x0c, 0x01, 0xfb, 0xf2, 0x36, 0x1f,
+    0x01, 0xfb, 0xf2, 0x36, 0x9d, 0x02, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x01,
+    0xfb, 0xf2, 0x36, 0x38, 0x85, 0x01, 0xfb, 0xf2, 0x36, 0x71, 0x01, 0xfb, 0xf2, 0x36, 0xc6, 0x02,
+    0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xaa, 0x8d, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x01,
+    0xfb, 0xf2, 0x36, 0x71, 0x02, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x01, 0xfb,
+    0xf2, 0x36, 0x55, 0x8e, 0x01, 0xfb, 0xf2, 0x36, 0x55, 0x02, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb,
+    0xf2, 0x36, 0xaa, 0x88, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x01, 0xfb, 0xf2, 0x36, 0x55, 0x01, 0xfb,
+    0xf2, 0x36, 0x38, 0x9c, 0xac, 0x01, 0xfb, 0xf2, 0x36, 0x38, 0x01, 0xfb, 0xf2, 0x36, 0xaa, 0x01,
+    0xfb, 0xf2, 0x36, 0xe2, 0x03, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xc3, 0x01, 0xfb,
+    0xf2, 0x36, 0x67, 0x01, 0xfb, 0xf2, 0x36, 0x32, 0x86, 0x01, 0xfb, 0xf2, 0x36, 0x71, 0x03, 0xfb,
+    0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0x55, 0x85, 0x01, 0xfb, 0xf2, 0x36, 0x38, 0x01, 0xfb,
+    0xf2, 0x36, 0x8d, 0x02, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xc6, 0x01, 0xfb, 0xf2,
+    0x36, 0x1c, 0x8d, 0x01, 0xfb, 0xf2, 0x36, 0x38, 0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x02, 0xfb, 0xf2,
+    0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xaa, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x8d, 0x01, 0xfb, 0xf2,
+    0x36, 0x55, 0x02, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xaa, 0xa7, 0xa9, 0x01, 0xfb,
+    0xf2, 0x36, 0x1c, 0x01, 0xfb, 0xf2, 0x36, 0x8d, 0x01, 0xfb, 0xf2, 0x36, 0xaa, 0x01, 0xfb, 0xf2,
+    0x36, 0xe2, 0x04, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0x8d, 0x01, 0xfb, 0xf2, 0x36,
+    0x1c, 0x88, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x01, 0xfb, 0xf2, 0x36, 0xc6, 0x02, 0xfb, 0xf2, 0x36,
+    0xff, 0x01, 0xfb, 0xf2, 0x36, 0x55, 0x86, 0x01, 0xfb, 0xf2, 0x36, 0x38, 0x01, 0xfb, 0xf2, 0x36,
+    0xe2, 0x02, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0x55, 0x8e, 0x01, 0xfb, 0xf2, 0x36,
+    0x55, 0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x02, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xaa,
+    0x01, 0xfb, 0xf2, 0x36, 0x55, 0x8c, 0x01, 0xfb, 0xf2, 0x36, 0x71, 0x02, 0xfb, 0xf2, 0x36, 0xff,
+    0x01, 0xfb, 0xf2, 0x36, 0xaa, 0xa7, 0xa9, 0x01, 0xfb, 0xf2, 0x36, 0x55, 0x04, 0xfb, 0xf2, 0x36,
+    0xff, 0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x01, 0xfb, 0xf2, 0x36, 0x8a, 0x01, 0xfb, 0xf2, 0x36, 0x1c,
+    0x8b, 0x01, 0xfb, 0xf2, 0x36, 0xaa, 0x02, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0x55,
+    0x87, 0x01, 0xfb, 0xf2, 0x36, 0xaa, 0x02, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0x8d,
+    0x8f, 0x01, 0xfb, 0xf2, 0x36, 0x8d, 0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x02, 0xfb, 0xf2, 0x36, 0xff,
+    0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x01, 0xfb, 0xf2, 0x36, 0x8d, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x8a,
+    0x01, 0xfb, 0xf2, 0x36, 0xaa, 0x02, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xaa, 0xa7,
+    0xa9, 0x01, 0xfb, 0xf2, 0x36, 0x2c, 0x01, 0xfb, 0xf2, 0x36, 0xc9, 0x02, 0xfb, 0xf2, 0x36, 0xff,
+    0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x01, 0xfb, 0xf2, 0x36, 0xa3, 0x01, 0xfb, 0xf2, 0x36, 0x38, 0x8b,
+    0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x01, 0xfb, 0xf2, 0x36, 0xc6, 0x02, 0xfb, 0xf2, 0x36, 0xff, 0x01,
+    0xfb, 0xf2, 0x36, 0x55, 0x87, 0x01, 0xfb, 0xf2, 0x36, 0xaa, 0x02, 0xfb, 0xf2, 0x36, 0xff, 0x01,
+    0xfb, 0xf2, 0x36, 0xc6, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x8e, 0x01, 0xfb, 0xf2, 0x36, 0x55, 0x01,
+    0xfb, 0xf2, 0x36, 0x8d, 0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x02, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb,
+    0xf2, 0x36, 0xe2, 0x01, 0xfb, 0xf2, 0x36, 0x55, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x89, 0x01, 0xfb,
+    0xf2, 0x36, 0xaa, 0x02, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0x8d, 0xa7, 0xaa, 0x01,
+    0xfb, 0xf2, 0x36, 0x8d, 0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x01, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb,
+    0xf2, 0x36, 0xe2, 0x01, 0xfb, 0xf2, 0x36, 0x8d, 0x8c, 0x01, 0xfb, 0xf2, 0x36, 0x71, 0x03, 0xfb,
+    0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0x55, 0x87, 0x01, 0xfb, 0xf2, 0x36, 0x71, 0x03, 0xfb,
+    0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0x55, 0x90, 0x01, 0xfb, 0xf2, 0x36, 0x55, 0x03, 0xfb,
+    0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x01, 0xfb, 0xf2, 0x36, 0xaa, 0x01, 0xfb, 0xf2,
+    0x36, 0x38, 0x87, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x01, 0xfb, 0xf2, 0x36, 0xc6, 0x02, 0xfb, 0xf2,
+    0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0x55, 0xa7, 0xaa, 0x01, 0xfb, 0xf2, 0x36, 0x38, 0x01, 0xfb,
+    0xf2, 0x36, 0x8d, 0x02, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x01, 0xfb, 0xf2,
+    0x36, 0x38, 0x8a, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x01, 0xfb, 0xf2, 0x36, 0xc6, 0x03, 0xfb, 0xf2,
+    0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xc6, 0x02, 0xfb, 0xf2, 0x36, 0xaa, 0x01, 0xfb, 0xf2, 0x36,
+    0x71, 0x01, 0xfb, 0xf2, 0x36, 0x5e, 0x01, 0xfb, 0xf2, 0x36, 0x58, 0x01, 0xfb, 0xf2, 0x36, 0x2b,
+    0x81, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x01, 0xfb, 0xf2, 0x36, 0xc6, 0x02, 0xfb, 0xf2, 0x36, 0xff,
+    0x01, 0xfb, 0xf2, 0x36, 0x71, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x90, 0x01, 0xfb, 0xf2, 0x36, 0x55,
+    0x01, 0xfb, 0xf2, 0x36, 0xaa, 0x03, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x01,
+    0xfb, 0xf2, 0x36, 0x8d, 0x01, 0xfb, 0xf2, 0x36, 0x71, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x84, 0x01,
+    0xfb, 0xf2, 0x36, 0x55, 0x03, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0x55, 0xa7, 0xaa,
+    0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x01, 0xfb, 0xf2, 0x36, 0x71, 0x03, 0xfb, 0xf2, 0x36, 0xff, 0x01,
+    0xfb, 0xf2, 0x36, 0x71, 0x88, 0x01, 0xfb, 0xf2, 0x36, 0x03, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x01,
+    0xfb, 0xf2, 0x36, 0x55, 0x07, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xc6, 0x01, 0xfb,
+    0xf2, 0x36, 0xb3, 0x01, 0xfb, 0xf2, 0x36, 0xa9, 0x01, 0xfb, 0xf2, 0x36, 0x6a, 0x01, 0xfb, 0xf2,
+    0x36, 0x38, 0x81, 0x01, 0xfb, 0xf2, 0x36, 0xaa, 0x02, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2,
+    0x36, 0x8d, 0x01, 0xfb, 0xf2, 0x36, 0x38, 0x90, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x01, 0xfb, 0xf2,
+    0x36, 0x55, 0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x03, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36,
+    0xe2, 0x01, 0xfb, 0xf2, 0x36, 0xc6, 0x01, 0xfb, 0xf2, 0x36, 0x71, 0x01, 0xfb, 0xf2, 0x36, 0x1c,
+    0x82, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x01, 0xfb, 0xf2, 0x36, 0x71, 0x02, 0xfb, 0xf2, 0x36, 0xff,
+    0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x01, 0xfb, 0xf2, 0x36, 0x38, 0xa7, 0xab, 0x01, 0xfb, 0xf2, 0x36,
+    0x1c, 0x01, 0xfb, 0xf2, 0x36, 0xaa, 0x02, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xe2,
+    0x01, 0xfb, 0xf2, 0x36, 0x38, 0x86, 0x01, 0xfb, 0xf2, 0x36, 0x03, 0x01, 0xfb, 0xf2, 0x36, 0x2f,
+    0x01, 0xfb, 0xf2, 0x36, 0xa3, 0x0a, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xfb, 0x01,
+    0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x01, 0xfb, 0xf2, 0x36, 0x55, 0x01, 0xfb,
+    0xf2, 0x36, 0x71, 0x01, 0xfb, 0xf2, 0x36, 0xc6, 0x01, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2,
+    0x36, 0xaa, 0x01, 0xfb, 0xf2, 0x36, 0x55, 0x92, 0x01, 0xfb, 0xf2, 0x36, 0x38, 0x01, 0xfb, 0xf2,
+    0x36, 0xaa, 0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x04, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36,
+    0xc6, 0x01, 0xfb, 0xf2, 0x36, 0xaa, 0x01, 0xfb, 0xf2, 0x36, 0x8d, 0x01, 0xfb, 0xf2, 0x36, 0xc6,
+    0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x01, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x01,
+    0xfb, 0xf2, 0x36, 0x8d, 0xa8, 0xac, 0x01, 0xfb, 0xf2, 0x36, 0x38, 0x01, 0xfb, 0xf2, 0x36, 0xe2,
+    0x02, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0x71, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x84,
+    0x01, 0xfb, 0xf2, 0x36, 0x0f, 0x01, 0xfb, 0xf2, 0x36, 0x2f, 0x01, 0xfb, 0xf2, 0x36, 0xad, 0x01,
+    0xfb, 0xf2, 0x36, 0xf5, 0x02, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xaa, 0x01, 0xfb,
+    0xf2, 0x36, 0x71, 0x02, 0xfb, 0xf2, 0x36, 0x55, 0x01, 0xfb, 0xf2, 0x36, 0x71, 0x02, 0xfb, 0xf2,
+    0x36, 0xaa, 0x01, 0xfb, 0xf2, 0x36, 0xc6, 0x03, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36,
+    0xc6, 0x01, 0xfb, 0xf2, 0x36, 0x71, 0x01, 0xfb, 0xf2, 0x36, 0xaa, 0x02, 0xfb, 0xf2, 0x36, 0xff,
+    0x01, 0xfb, 0xf2, 0x36, 0x8d, 0x93, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x01, 0xfb, 0xf2, 0x36, 0x38,
+    0x01, 0xfb, 0xf2, 0x36, 0x71, 0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x08, 0xfb, 0xf2, 0x36, 0xff, 0x01,
+    0xfb, 0xf2, 0x36, 0x71, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0xa8, 0xac, 0x01, 0xfb, 0xf2, 0x36, 0x1c,
+    0x01, 0xfb, 0xf2, 0x36, 0xc6, 0x02, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0x8d, 0x01,
+    0xfb, 0xf2, 0x36, 0x38, 0x84, 0x01, 0xfb, 0xf2, 0x36, 0x2f, 0x01, 0xfb, 0xf2, 0x36, 0x64, 0x01,
+    0xfb, 0xf2, 0x36, 0xe2, 0x02, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x01, 0xfb,
+    0xf2, 0x36, 0x55, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x82, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x02, 0xfb,
+    0xf2, 0x36, 0x55, 0x01, 0xfb, 0xf2, 0x36, 0x71, 0x01, 0xfb, 0xf2, 0x36, 0xb9, 0x02, 0xfb, 0xf2,
+    0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x01, 0xfb, 0xf2, 0x36, 0x8d, 0x01, 0xfb, 0xf2, 0x36,
+    0xaa, 0x02, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xaa, 0x95, 0x01, 0xfb, 0xf2, 0x36,
+    0x1c, 0x01, 0xfb, 0xf2, 0x36, 0x8d, 0x01, 0xfb, 0xf2, 0x36, 0xaa, 0x07, 0xfb, 0xf2, 0x36, 0xff,
+    0x01, 0xfb, 0xf2, 0x36, 0x38, 0xa9, 0xad, 0x01, 0xfb, 0xf2, 0x36, 0x71, 0x01, 0xfb, 0xf2, 0x36,
+    0xc6, 0x01, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x01, 0xfb, 0xf2, 0x36, 0xaa,
+    0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x82, 0x01, 0xfb, 0xf2, 0x36, 0x38, 0x01, 0xfb, 0xf2, 0x36, 0xaa,
+    0x03, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x01, 0xfb, 0xf2, 0x36, 0x55, 0x88,
+    0x01, 0xfb, 0xf2, 0x36, 0x12, 0x01, 0xfb, 0xf2, 0x36, 0xb3, 0x02, 0xfb, 0xf2, 0x36, 0xff, 0x02,
+    0xfb, 0xf2, 0x36, 0x8d, 0x01, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xef, 0x01, 0xfb,
+    0xf2, 0x36, 0xbf, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x8e, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x01, 0xfb,
+    0xf2, 0x36, 0x58, 0x01, 0xfb, 0xf2, 0x36, 0x48, 0x01, 0xfb, 0xf2, 0x36, 0x0f, 0x85, 0x01, 0xfb,
+    0xf2, 0x36, 0x38, 0x01, 0xfb, 0xf2, 0x36, 0x8d, 0x02, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2,
+    0x36, 0xaa, 0x01, 0xfb, 0xf2, 0x36, 0x8d, 0x01, 0xfb, 0xf2, 0x36, 0x38, 0xaa, 0xad, 0x01, 0xfb,
+    0xf2, 0x36, 0x1c, 0x01, 0xfb, 0xf2, 0x36, 0x71, 0x03, 0xfb, 0xf2, 0x36, 0xff, 0x02, 0xfb, 0xf2,
+    0x36, 0x8d, 0x01, 0xfb, 0xf2, 0x36, 0xaa, 0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x03, 0xfb, 0xf2, 0x36,
+    0xff, 0x01, 0xfb, 0xf2, 0x36, 0xaa, 0x01, 0xfb, 0xf2, 0x36, 0x55, 0x8a, 0x01, 0xfb, 0xf2, 0x36,
+    0xaa, 0x02, 0xfb, 0xf2, 0x36, 0xff, 0x02, 0xfb, 0xf2, 0x36, 0xaa, 0x02, 0xfb, 0xf2, 0x36, 0xff,
+    0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x01, 0xfb, 0xf2, 0x36, 0x55, 0x8e, 0x01, 0xfb, 0xf2, 0x36, 0x8d,
+    0x01, 0xfb, 0xf2, 0x36, 0xf2, 0x01, 0xfb, 0xf2, 0x36, 0xdf, 0x01, 0xfb, 0xf2, 0x36, 0x4b, 0xb6,
+    0xae, 0x01, 0xfb, 0xf2, 0x36, 0x38, 0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x08, 0xfb, 0xf2, 0x36, 0xff,
+    0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x01, 0xfb, 0xf2, 0x36, 0x55, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x8a,
+    0x01, 0xfb, 0xf2, 0x36, 0x8d, 0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x01, 0xfb, 0xf2, 0x36, 0xff, 0x01,
+    0xfb, 0xf2, 0x36, 0xaa, 0x01, 0xfb, 0xf2, 0x36, 0x8d, 0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x01, 0xfb,
+    0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xec, 0x01, 0xfb, 0xf2, 0x36, 0x71, 0x8d, 0x01, 0xfb,
+    0xf2, 0x36, 0x1c, 0x01, 0xfb, 0xf2, 0x36, 0xc6, 0x02, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2,
+    0x36, 0x5b, 0xb6, 0xaf, 0x01, 0xfb, 0xf2, 0x36, 0x8d, 0x07, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb,
+    0xf2, 0x36, 0x8d, 0x01, 0xfb, 0xf2, 0x36, 0x38, 0x8c, 0x01, 0xfb, 0xf2, 0x36, 0x55, 0x01, 0xfb,
+    0xf2, 0x36, 0xaa, 0x01, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xaa, 0x01, 0xfb, 0xf2,
+    0x36, 0x55, 0x01, 0xfb, 0xf2, 0x36, 0x8d, 0x01, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36,
+    0xfb, 0x01, 0xfb, 0xf2, 0x36, 0xc6, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x89, 0x01, 0xfb, 0xf2, 0x36,
+    0x1c, 0x01, 0xfb, 0xf2, 0x36, 0x55, 0x01, 0xfb, 0xf2, 0x36, 0x71, 0x01, 0xfb, 0xf2, 0x36, 0xaa,
+    0x02, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x01, 0xfb, 0xf2, 0x36, 0x2f, 0xb6,
+    0xaf, 0x01, 0xfb, 0xf2, 0x36, 0x38, 0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x04, 0xfb, 0xf2, 0x36, 0xff,
+    0x01, 0xfb, 0xf2, 0x36, 0x71, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x8e, 0x01, 0xfb, 0xf2, 0x36, 0x55,
+    0x01, 0xfb, 0xf2, 0x36, 0xaa, 0x01, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xaa, 0x02,
+    0xfb, 0xf2, 0x36, 0x55, 0x03, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0x55, 0x82, 0x01,
+    0xfb, 0xf2, 0x36, 0x1c, 0x01, 0xfb, 0xf2, 0x36, 0x38, 0x03, 0xfb, 0xf2, 0x36, 0x55, 0x01, 0xfb,
+    0xf2, 0x36, 0x71, 0x01, 0xfb, 0xf2, 0x36, 0xaa, 0x01, 0xfb, 0xf2, 0x36, 0xc6, 0x04, 0xfb, 0xf2,
+    0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x01, 0xfb, 0xf2, 0x36, 0x8d, 0xb7, 0xaf, 0x01, 0xfb,
+    0xf2, 0x36, 0x1c, 0x01, 0xfb, 0xf2, 0x36, 0xc6, 0x04, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2,
+    0x36, 0x1c, 0x8f, 0x01, 0xfb, 0xf2, 0x36, 0x55, 0x01, 0xfb, 0xf2, 0x36, 0xaa, 0x01, 0xfb, 0xf2,
+    0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xaa, 0x01, 0xfb, 0xf2, 0x36, 0x55, 0x01, 0xfb, 0xf2, 0x36,
+    0x38, 0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x02, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0x71,
+    0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x01, 0xfb, 0xf2, 0x36, 0x38, 0x01, 0xfb, 0xf2, 0x36, 0x71, 0x01,
+    0xfb, 0xf2, 0x36, 0x8d, 0x03, 0xfb, 0xf2, 0x36, 0xaa, 0x07, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb,
+    0xf2, 0x36, 0xaa, 0x01, 0xfb, 0xf2, 0x36, 0x55, 0xb7, 0xb0, 0x01, 0xfb, 0xf2, 0x36, 0x71, 0x01,
+    0xfb, 0xf2, 0x36, 0xc6, 0x02, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xaa, 0x90, 0x01,
+    0xfb, 0xf2, 0x36, 0x55, 0x01, 0xfb, 0xf2, 0x36, 0xaa, 0x01, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb,
+    0xf2, 0x36, 0xaa, 0x01, 0xfb, 0xf2, 0x36, 0x55, 0x81, 0x01, 0xfb, 0xf2, 0x36, 0xaa, 0x03, 0xfb,
+    0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xc6, 0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x09, 0xfb, 0xf2,
+    0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xc6, 0x01, 0xfb, 0xf2, 0x36, 0xaa, 0x01, 0xfb, 0xf2, 0x36,
+    0x71, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0xb8, 0xb0, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x01, 0xfb, 0xf2,
+    0x36, 0x71, 0x02, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x01, 0xfb, 0xf2, 0x36,
+    0x38, 0x8f, 0x01, 0xfb, 0xf2, 0x36, 0x71, 0x01, 0xfb, 0xf2, 0x36, 0xc6, 0x01, 0xfb, 0xf2, 0x36,
+    0xff, 0x01, 0xfb, 0xf2, 0x36, 0xaa, 0x01, 0xfb, 0xf2, 0x36, 0x55, 0x81, 0x01, 0xfb, 0xf2, 0x36,
+    0x71, 0x01, 0xfb, 0xf2, 0x36, 0xc6, 0x08, 0xfb, 0xf2, 0x36, 0xff, 0x03, 0xfb, 0xf2, 0x36, 0xaa,
+    0x01, 0xfb, 0xf2, 0x36, 0x8d, 0x01, 0xfb, 0xf2, 0x36, 0x55, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0xbb,
+    0xb1, 0x01, 0xfb, 0xf2, 0x36, 0x55, 0x03, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0x55,
+    0x8f, 0x01, 0xfb, 0xf2, 0x36, 0x8d, 0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x01, 0xfb, 0xf2, 0x36, 0xff,
+    0x01, 0xfb, 0xf2, 0x36, 0xaa, 0x01, 0xfb, 0xf2, 0x36, 0x55, 0x81, 0x01, 0xfb, 0xf2, 0x36, 0x55,
+    0x01, 0xfb, 0xf2, 0x36, 0xaa, 0x04, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xc6, 0x01,
+    0xfb, 0xf2, 0x36, 0xaa, 0x01, 0xfb, 0xf2, 0x36, 0x71, 0x04, 0xfb, 0xf2, 0x36, 0x55, 0x01, 0xfb,
+    0xf2, 0x36, 0x38, 0xbd, 0xb1, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x01, 0xfb, 0xf2, 0x36, 0xc6, 0x02,
+    0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0x8d, 0x8e, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x01,
+    0xfb, 0xf2, 0x36, 0xc6, 0x02, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0x71, 0x01, 0xfb,
+    0xf2, 0x36, 0x1c, 0x81, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x01, 0xfb, 0xf2, 0x36, 0x55, 0x01, 0xfb,
+    0xf2, 0x36, 0xaa, 0x01, 0xfb, 0xf2, 0x36, 0x8d, 0x01, 0xfb, 0xf2, 0x36, 0x71, 0x01, 0xfb, 0xf2,
+    0x36, 0x55, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0xc4, 0xb2, 0x01, 0xfb, 0xf2, 0x36, 0x71, 0x03, 0xfb,
+    0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0x38, 0x8d, 0x01, 0xfb, 0xf2, 0x36, 0x71, 0x03, 0xfb,
+    0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0x5b, 0x01, 0xfb, 0xf2, 0x36, 0x19, 0xcc, 0xb2, 0x01,
+    0xfb, 0xf2, 0x36, 0x38, 0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x02, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb,
+    0xf2, 0x36, 0x71, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x8a, 0x01, 0xfb, 0xf2, 0x36, 0x38, 0x01, 0xfb,
+    0xf2, 0x36, 0x55, 0x04, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0x3e, 0x01, 0xfb, 0xf2,
+    0x36, 0x0f, 0xcc, 0xb3, 0x01, 0xfb, 0xf2, 0x36, 0xaa, 0x02, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb,
+    0xf2, 0x36, 0xc6, 0x01, 0xfb, 0xf2, 0x36, 0x71, 0x85, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x01, 0xfb,
+    0xf2, 0x36, 0x55, 0x01, 0xfb, 0xf2, 0x36, 0x71, 0x01, 0xfb, 0xf2, 0x36, 0x8d, 0x01, 0xfb, 0xf2,
+    0x36, 0xaa, 0x05, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0x8d, 0xce, 0xb3, 0x01, 0xfb,
+    0xf2, 0x36, 0x71, 0x01, 0xfb, 0xf2, 0x36, 0xc6, 0x03, 0xfb, 0xf2, 0x36, 0xff, 0x02, 0xfb, 0xf2,
+    0x36, 0x1c, 0x01, 0xfb, 0xf2, 0x36, 0x38, 0x01, 0xfb, 0xf2, 0x36, 0x71, 0x01, 0xfb, 0xf2, 0x36,
+    0xaa, 0x01, 0xfb, 0xf2, 0x36, 0xc6, 0x07, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xc6,
+    0x01, 0xfb, 0xf2, 0x36, 0x8d, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0xce, 0xb3, 0x01, 0xfb, 0xf2, 0x36,
+    0x38, 0x01, 0xfb, 0xf2, 0x36, 0x8d, 0x03, 0xfb, 0xf2, 0x36, 0xff, 0x02, 0xfb, 0xf2, 0x36, 0x71,
+    0x01, 0xfb, 0xf2, 0x36, 0x8d, 0x01, 0xfb, 0xf2, 0x36, 0xc6, 0x08, 0xfb, 0xf2, 0x36, 0xff, 0x01,
+    0xfb, 0xf2, 0x36, 0xc6, 0x01, 0xfb, 0xf2, 0x36, 0x71, 0x01, 0xfb, 0xf2, 0x36, 0x38, 0xcf, 0xb4,
+    0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x01, 0xfb, 0xf2, 0x36, 0xc6, 0x09, 0xfb, 0xf2, 0x36, 0xff, 0x01,
+    0xfb, 0xf2, 0x36, 0xc6, 0x01, 0xfb, 0xf2, 0x36, 0xaa, 0x01, 0xfb, 0xf2, 0x36, 0x8d, 0x02, 0xfb,
+    0xf2, 0x36, 0x55, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0xd1, 0xb5, 0x01, 0xfb, 0xf2, 0x36, 0x71, 0x05,
+    0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x01, 0xfb, 0xf2, 0x36, 0xaa, 0x01, 0xfb,
+    0xf2, 0x36, 0x8d, 0x01, 0xfb, 0xf2, 0x36, 0x55, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0xd6, 0xb5, 0x01,
+    0xfb, 0xf2, 0x36, 0x38, 0x01, 0xfb, 0xf2, 0x36, 0xe2, 0x03, 0xfb, 0xf2, 0x36, 0xff, 0x01, 0xfb,
+    0xf2, 0x36, 0xe2, 0x01, 0xfb, 0xf2, 0x36, 0x8d, 0x01, 0xfb, 0xf2, 0x36, 0x55, 0x01, 0xfb, 0xf2,
+    0x36, 0x38, 0xd8, 0xb6, 0x01, 0xfb, 0xf2, 0x36, 0x8d, 0x02, 0xfb, 0xf2, 0x36, 0xe2, 0x01, 0xfb,
+    0xf2, 0x36, 0x71, 0x01, 0xfb, 0xf2, 0x36, 0x38, 0xdb, 0xb6, 0x01, 0xfb, 0xf2, 0x36, 0x1c, 0x02,
+    0xfb, 0xf2, 0x36, 0x38, 0xdd, 0xff, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff,
+    0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x97, 0xff, 0x97
+};
+
+static constexpr
+uint8_t m_sprite_logo_mask[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x3f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xe0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xf0, 0x00,
+    0x00, 0x00, 0x00, 0x1f, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0xf8, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x07, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1e, 0x01, 0xfc, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0x80, 0x0f, 0xf8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x1f, 0xf8, 0x07, 0x80, 0x3f,
+    0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x3f, 0xc0,
+    0x03, 0xc0, 0x3e, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x7e, 0x00, 0x00,
+    0x00, 0x3f, 0x00, 0x03, 0xc0, 0x78, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00,
+    0x3f, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0xe0, 0x70, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1f, 0x80, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xf0, 0x1e, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1f, 0x80, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xf0, 0x1e,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x1f, 0x80, 0x0f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xe0, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0, 0x0f, 0xc0, 0x0f, 0xc0, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0xe0, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfe, 0x0f, 0x80, 0x07,
+    0xc0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xe0, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfe,
+    0x0f, 0x80, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x80, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x03, 0xff, 0x8f, 0x80, 0x03, 0x80, 0x00, 0x00, 0x00, 0x07, 0xff, 0x00, 0x00, 0x1e, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xcf, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0x80,
+    0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1f, 0xff, 0xc0, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xc0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0e, 0x03, 0xe0, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff,
+    0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xe0, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0xff, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x78, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00,
+    0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf8, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x70, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x0f, 0xfc, 0x00, 0x7f, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x70, 0x01, 0xe0, 0x00, 0x00, 0x00, 0x03, 0xff, 0xfc, 0x00, 0x07, 0xff,
+    0x00, 0x7f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x70, 0x03, 0xc0, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff,
+    0x80, 0x07, 0xff, 0x80, 0x7f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x78, 0x03, 0xc0, 0x00, 0x00, 0x00,
+    0x0f, 0xff, 0xff, 0x80, 0x07, 0xff, 0x80, 0x7f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x78, 0x07, 0x80,
+    0x00, 0x00, 0x00, 0x1f, 0xf7, 0xff, 0xe0, 0x07, 0xdf, 0xf8, 0x7f, 0xc0, 0x00, 0x00, 0x00, 0x00,
+    0x38, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x80, 0x0f, 0xf0, 0x07, 0xdf, 0xf8, 0x7f, 0xc0, 0x00,
+    0x00, 0x00, 0x00, 0x78, 0x0f, 0x00, 0x00, 0x04, 0x00, 0x1f, 0x00, 0x07, 0xf0, 0x07, 0xef, 0xf8,
+    0x7f, 0x80, 0x00, 0x07, 0x80, 0x00, 0x78, 0x3e, 0x00, 0xf0, 0x1e, 0x00, 0x1e, 0x00, 0x03, 0xf8,
+    0x03, 0xe3, 0xf8, 0x3e, 0x00, 0x00, 0x07, 0xf0, 0x00, 0x70, 0x3c, 0xff, 0xfc, 0x1e, 0x00, 0x1f,
+    0x00, 0x00, 0xfc, 0x03, 0xe0, 0xf8, 0x00, 0x00, 0x00, 0x03, 0xf8, 0x00, 0xf0, 0x3f, 0xff, 0xfc,
+    0x1e, 0x00, 0x1f, 0x00, 0x00, 0xfc, 0x03, 0xe0, 0x70, 0x00, 0x00, 0x00, 0x01, 0xff, 0x81, 0xf0,
+    0x7f, 0xff, 0xbe, 0x1f, 0x00, 0x1f, 0x80, 0x00, 0x7c, 0x03, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x3f, 0xff, 0xe0, 0x7f, 0x80, 0x0c, 0x1f, 0x00, 0x0f, 0x80, 0x00, 0x3e, 0x01, 0xe0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0f, 0xff, 0xe0, 0x38, 0x00, 0x00, 0x1f, 0x00, 0x0f, 0xc0, 0x00, 0x3e, 0x01,
+    0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0x00, 0x00, 0x1f, 0xf0, 0x0f, 0x80, 0x0f, 0xc0,
+    0x00, 0x3e, 0x01, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xf8, 0x0f,
+    0x80, 0x03, 0xe0, 0x00, 0x1e, 0x01, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xfe, 0x0f, 0xc0, 0x03, 0xf0, 0x00, 0x1e, 0x01, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0xff, 0xfe, 0x07, 0xc0, 0x03, 0xf0, 0x00, 0x1e, 0x01, 0xe0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0x7f, 0x07, 0xc0, 0x01, 0xf8, 0x00, 0x1e, 0x01, 0xc0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf8, 0x1f, 0x07, 0xe0, 0x00, 0xfc, 0x00,
+    0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xe0, 0x1f, 0x03, 0xe0,
+    0x00, 0x7e, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x80,
+    0x0f, 0x01, 0xe0, 0x00, 0x3f, 0x80, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x7f, 0x00, 0x1f, 0x01, 0xf0, 0x00, 0x3f, 0xc0, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x1f, 0x01, 0xf0, 0x00, 0x0f, 0xe0, 0x3e, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x3f, 0xfd, 0xf8, 0x00, 0x07, 0xfc, 0x3e,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x00, 0xff, 0xfe, 0xf8, 0x00,
+    0x07, 0xfe, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x81, 0xff,
+    0xff, 0xf8, 0x00, 0x01, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0f, 0xc3, 0xff, 0xff, 0xf8, 0x00, 0x00, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0f, 0xc3, 0xfc, 0xff, 0xf8, 0x00, 0x00, 0x3f, 0xf8, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xe7, 0xf0, 0x0f, 0xfc, 0x00, 0x0f, 0x07, 0xf0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xe0, 0x07, 0xfc, 0x00, 0x0f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xe0, 0x07,
+    0xfc, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0xff, 0x80, 0x07, 0xfe, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0xfe, 0x00, 0x07, 0xfe, 0x7f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfc, 0x00, 0x07, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x07, 0xdf, 0xff, 0xfc, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x07, 0xdf,
+    0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c,
+    0x00, 0x07, 0xdf, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x7c, 0x00, 0x0f, 0xdf, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x3f, 0xc0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x07, 0xff, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff,
+    0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x1f, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xfc, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xe0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+static constexpr spritemeta_t m_sprites[] = {
+{ "ball", 5, 5, 3, 6, 54, 1, 1, SPRITE_RAW, m_sprite_ball, m_sprite_ball_pixels, m_sprite_ball_mask, NULL },
+{ "bat_normal", 16, 4, 2, 4, 52, 2, 1, SPRITE_RAW, m_sprite_bat_normal, m_sprite_bat_normal_pixels, m_sprite_bat_normal_mask, m_sprite_bat_normal_frames },
+{ "bat_wide", 24, 4, 2, 4, 60, 3, 1, SPRITE_RAW, m_sprite_bat_wide, m_sprite_bat_wide_pixels, m_sprite_bat_wide_mask, m_sprite_bat_wide_frames },
+{ "brick_orange", 16, 8, 2, 3, 64, 2, 1, SPRITE_RAW, m_sprite_brick_orange, m_sprite_brick_orange_pixels, m_sprite_brick_orange_mask, m_sprite_brick_orange_frames },
+{ "brick_red", 16, 8, 2, 3, 64, 2, 1, SPRITE_RAW, m_sprite_brick_red, m_sprite_brick_red_pixels, m_sprite_brick_red_mask, m_sprite_brick_red_frames },
+{ "brick_yellow", 16, 8, 2, 3, 64, 2, 1, SPRITE_RAW, m_sprite_brick_yellow, m_sprite_brick_yellow_pixels, m_sprite_brick_yellow_mask, m_sprite_brick_yellow_frames },
+{ "logo", 150, 90, 7, 75, 12133, 1, 1, SPRITE_RLE, m_sprite_logo, m_sprite_logo_pixels, m_sprite_logo_mask, NULL },
+{ NULL, 0, 0, 0, 0, 0, 0, 0, SPRITE_PACKED, NULL, NULL, NULL, NULL }};
@@ -0,0 +1,268 @@
+/*
+ * audit.cpp - part of 32Blox, a breakout game for the 32blit built to
+ * explore the API.
+ *
+ * A debugging aid, only built in when BLOX_AUDIT is defined, which keeps an
+ * eye on the main loop. It counts every heap allocation made during each
+ * update() and render() call (there shouldn't be any!), and every so often
+ * paints the stack below the caller with a known pattern so that we can see
+ * how deep each game state actually goes.
+ *
+ * With BLOX_AUDIT_STRICT as well, the first frame that allocates ends the run
+ * with a failure, which makes soak runs a zero-allocation check.
+ *
+ * Please note that this is a first attempt at understanding a somewhat fluid
+ * API on a shiny new bit of kit, so it probably is not full of 'best practice'.
+ * It will hopefully serve as some sort of starting point, however.
+ *
+ * Coyright (C) 2020 Pete Favelle <pete@fsquared.co.uk>
+ *
+ * This software is provided under the MIT License. See LICENSE.txt for details.
+ */
+
+#ifdef BLOX_AUDIT
+
+/* System headers. */
+
+#include <new>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+/* Local headers. */
+
+#include "32blit.hpp"
+#include "32blox.hpp"
+
+
+/* Constants. */
+
+#define AUDIT_STACK_DEPTH   4096    /* How far below the caller we paint.    */
+#define AUDIT_STACK_PAINT   0xa5
+#define AUDIT_SAMPLE_RATE   16      /* Paint the stack one call in this many */
+
+
+/* Module variables. */
+
+static volatile uint32_t  m_allocations;
+static uint32_t           m_start_allocations;
+static gamestate_t        m_state;
+static audit_call_t       m_call;
+static const volatile uint8_t *m_painted;
+static uint32_t           m_calls;
+static struct {
+  uint32_t  stack;                        /* Deepest stack use seen.          */
+  uint32_t  allocations;                  /* Allocations in update/render.    */
+  uint32_t  frames;                       /* Calls which allocated anything.  */
+}                         m_stats[STATE_MAX][AUDIT_MAX];
+
+static const char        *m_state_names[STATE_MAX] = { "splash", "game", "death", "hiscore" };
+static const char        *m_call_names[AUDIT_MAX] = { "update", "render" };
+
+
+/* Allocation hooks. */
+
+/*
+ * The linker is asked to --wrap malloc and friends, so every call to them
+ * comes here first; we count it, and pass it on to the real thing.
+ */
+
+extern "C" {
+
+void *__real_malloc( size_t );
+void *__real_calloc( size_t, size_t );
+void *__real_realloc( void *, size_t );
+
+void *__wrap_malloc( size_t p_size )
+{
+  m_allocations++;
+  return __real_malloc( p_size );
+}
+
+void *__wrap_calloc( size_t p_count, size_t p_size )
+{
+  m_allocations++;
+  return __real_calloc( p_count, p_size );
+}
+
+void *__wrap_realloc( void *p_block, size_t p_size )
+{
+  m_allocations++;
+  return __real_realloc( p_block, p_size );
+}
+
+}
+
+void *operator new( size_t p_size )
+{
+  void *l_block = malloc( p_size ? p_size : 1 );
+
+  if ( l_block == NULL )
+  {
+    throw std::bad_alloc();
+  }
+  return l_block;
+}
+
+void *operator new[]( size_t p_size )
+{
+  return operator new( p_size );
+}
+
+void operator delete( void *p_block ) noexcept
+{
+  free( p_block );
+}
+
+void operator delete[]( void *p_block ) noexcept
+{
+  free( p_block );
+}
+
+void operator delete( void *p_block, size_t ) noexcept
+{
+  operator delete( p_block );
+}
+
+void operator delete[]( void *p_block, size_t ) noexcept
+{
+  operator delete[]( p_block );
+}
+
+
+/* Module functions. */
+
+/*
+ * _audit_paint - paints a block of stack with a known pattern. This has to
+ *                be a real function call, so that the block sits below
+ *                whoever called audit_begin; we remember where it was.
+ */
+
+static void __attribute__ (( noinline )) _audit_paint( void )
+{
+  volatile uint8_t l_region[AUDIT_STACK_DEPTH];
+  uint32_t         l_index;
+
+  for ( l_index = 0; l_index < AUDIT_STACK_DEPTH; l_index++ )
+  {
+    l_region[l_index] = AUDIT_STACK_PAINT;
+  }
+  m_painted = l_region;
+}
+
+
+/*
+ * _audit_measure - works out how much of the painted stack got scribbled on.
+ *                  The stack grows down, so we count the untouched bytes up
+ *                  from the bottom.
+ */
+
+static uint32_t _audit_measure( void )
+{
+  uint32_t l_index;
+
+  for ( l_index = 0; l_index < AUDIT_STACK_DEPTH; l_index++ )
+  {
+    if ( m_painted[l_index] != AUDIT_STACK_PAINT )
+    {
+      break;
+    }
+  }
+  return AUDIT_STACK_DEPTH - l_index;
+}
+
+
+/* Functions. */
+
+/*
+ * audit_begin - called just before a state's update or render.
+ *
+ * audit_call_t - which call this is
+ * gamestate_t  - the state it's being made for
+ */
+
+void audit_begin( audit_call_t p_call, gamestate_t p_state )
+{
+  m_call = p_call;
+  m_state = p_state;
+
+  /* Only paint every so often, it's not cheap. */
+  m_painted = NULL;
+  if ( ( ++m_calls % AUDIT_SAMPLE_RATE ) == 0 )
+  {
+    _audit_paint();
+  }
+
+  m_start_allocations = m_allocations;
+}
+
+
+/*
+ * audit_end - called just after a state's update or render, to see what
+ *             it got up to.
+ */
+
+void audit_end( void )
+{
+  uint32_t l_allocations, l_stack;
+
+  /* Take the allocation count first, before we do anything ourselves. */
+  l_allocations = m_allocations - m_start_allocations;
+
+  if ( m_painted != NULL )
+  {
+    l_stack = _audit_measure();
+    if ( l_stack > m_stats[m_state][m_call].stack )
+    {
+      m_stats[m_state][m_call].stack = l_stack;
+    }
+  }
+
+  if ( l_allocations > 0 )
+  {
+    m_stats[m_state][m_call].allocations += l_allocations;
+    m_stats[m_state][m_call].frames++;
+    printf( "audit: %s %s made %lu allocation(s)\n", m_state_names[m_state],
+            m_call_names[m_call], (unsigned long)l_allocations );
+#ifdef BLOX_AUDIT_STRICT
+    audit_report();
+    exit( EXIT_FAILURE );
+#endif
+  }
+}
+
+
+/*
+ * audit_report - prints out everything we've seen so far.
+ */
+
+void audit_report( void )
+{
+  uint8_t  l_state, l_call;
+  uint16_t l_peak;
+  fixed_t  l_substeps;
+
+  for ( l_state = 0; l_state < STATE_MAX; l_state++ )
+  {
+    for ( l_call = 0; l_call < AUDIT_MAX; l_call++ )
+    {
+      printf( "audit: %-8s %-6s stack %4lu bytes, %lu allocation(s) in %lu call(s)\n",
+              m_state_names[l_state], m_call_names[l_call],
+              (unsigned long)m_stats[l_state][l_call].stack,
+              (unsigned long)m_stats[l_state][l_call].allocations,
+              (unsigned long)m_stats[l_state][l_call].frames );
+    }
+  }
+
+  /* And how hard the ball physics has had to work. */
+  l_substeps = ball_substeps( &l_peak );
+  printf( "audit: ball substeps %lu.%02lu per tick, peak %u\n",
+          (unsigned long)FIXED_INT( l_substeps ),
+          (unsigned long)( ( ( l_substeps & ( FIXED_ONE - 1 ) ) * 100 ) >> FIXED_SHIFT ), l_peak );
+}
+
+#endif /* BLOX_AUDIT */
+
+
+/* End of audit.cpp */
@@ -0,0 +1,254 @@
+/*
+ * autoplay.cpp - part of 32Blox, a breakout game for the 32blit built to
+ * explore the API.
+ *
+ * A computer player, for demos and for leaving the game running unattended
+ * on soak and performance runs. Each tick it asks the balls where they'll
+ * come down, picks the one that'll get there first, and steers the bat to
+ * meet it; it takes each ball on a different bit of the bat, so that the
+ * angles vary enough to get into every corner of the board.
+ *
+ * To keep it honest (and beatable), it only sees where things were a few
+ * ticks ago, and its aim is off by a few pixels; BLOX_AUTOPLAY_DELAY and
+ * BLOX_AUTOPLAY_ERROR set how much. Its decisions come from its own seeded
+ * random numbers, and it hands out the seeds for the game's random numbers
+ * too, so the same run plays out the same way every time.
+ *
+ * Please note that this is a first attempt at understanding a somewhat fluid
+ * API on a shiny new bit of kit, so it probably is not full of 'best practice'.
+ * It will hopefully serve as some sort of starting point, however.
+ *
+ * Coyright (C) 2020 Pete Favelle <pete@fsquared.co.uk>
+ *
+ * This software is provided under the MIT License. See LICENSE.txt for details.
+ */
+
+/* System headers. */
+
+#include <stdio.h>
+
+
+/* Local headers. */
+
+#include "32blit.hpp"
+#include "32blox.hpp"
+
+
+/* Constants. */
+
+#ifndef BLOX_AUTOPLAY_DELAY
+#define BLOX_AUTOPLAY_DELAY 2                   /* Reaction time, in ticks.  */
+#endif
+#ifndef BLOX_AUTOPLAY_ERROR
+#define BLOX_AUTOPLAY_ERROR 1                   /* Aiming error, in pixels.  */
+#endif
+
+#define AUTOPLAY_DELAY_MAX  32
+#define AUTOPLAY_AIM        60                  /* How much of the bat to use */
+                                                /* in percent, either side.  */
+#define AUTOPLAY_HOLD       30                  /* Ticks to hold a new ball. */
+#define AUTOPLAY_SEED       0x32b10c5
+
+
+/* Module variables. */
+
+static bool         m_active;
+static uint32_t     m_seed;
+static uint32_t     m_tick;
+static fixed_t      m_targets[AUTOPLAY_DELAY_MAX];  /* What we wanted, lately. */
+static fixed_t      m_offset;                   /* Where on the bat to take   */
+                                                /* the ball, this time.       */
+static fixed_t      m_hold;                     /* Where to launch from.      */
+static uint16_t     m_held;
+static uint16_t     m_last_ticks;
+static uint32_t     m_games;
+
+static_assert( BLOX_AUTOPLAY_DELAY < AUTOPLAY_DELAY_MAX, "autoplay reaction time is too long" );
+
+
+/* Module functions. */
+
+/*
+ * _autoplay_random - a small LCG of our own, so we always make the same
+ *                    choices in the same situation.
+ *
+ * uint16_t - the range wanted
+ *
+ * Returns a value from 0 to one less than the range.
+ */
+
+static uint16_t _autoplay_random( uint16_t p_range )
+{
+  m_seed = ( m_seed * 1103515245 ) + 12345;
+  return ( m_seed >> 16 ) % p_range;
+}
+
+
+/*
+ * _autoplay_aim - picks where on the bat to take the next ball, including
+ *                 however far off we're going to be.
+ *
+ * bat_t - the player's bat
+ */
+
+static void _autoplay_aim( bat_t p_bat )
+{
+  int16_t l_reach, l_error;
+
+  l_reach = ( p_bat.width / 2 ) * AUTOPLAY_AIM / 100;
+  l_error = BLOX_AUTOPLAY_ERROR;
+  m_offset = FIXED_FROM_INT( (int16_t)_autoplay_random( ( 2 * l_reach ) + 1 ) - l_reach )
+           + FIXED_FROM_INT( (int16_t)_autoplay_random( ( 2 * l_error ) + 1 ) - l_error );
+}
+
+
+/* Functions. */
+
+/*
+ * autoplay_start - hands the bat over to the computer, for the next game.
+ */
+
+void autoplay_start( void )
+{
+  uint8_t l_index;
+
+  m_active = true;
+  m_seed = AUTOPLAY_SEED;
+  m_tick = 0;
+  m_offset = 0;
+  m_held = 0;
+  m_last_ticks = 0xffff;
+  for ( l_index = 0; l_index < AUTOPLAY_DELAY_MAX; l_index++ )
+  {
+    m_targets[l_index] = FIXED_FROM_INT( blit::fb.bounds.w / 2 );
+  }
+}
+
+
+/*
+ * autoplay_active - reports if the computer is playing.
+ */
+
+bool autoplay_active( void )
+{
+  return m_active;
+}
+
+
+/*
+ * autoplay_seed - hands out a seed for the game's own random numbers, from
+ *                 ours, so that every game in a run is different but the run
+ *                 as a whole is the same each time.
+ *
+ * Returns the seed.
+ */
+
+uint32_t autoplay_seed( void )
+{
+  return ( (uint32_t)_autoplay_random( 0xffff ) << 16 ) | _autoplay_random( 0xffff );
+}
+
+
+/*
+ * autoplay_update - decides what the computer is pressing this tick.
+ *
+ * bat_t          - the player's bat
+ * const int8_t * - the IDs of the balls in play, MAX_BALLS of them
+ *
+ * Returns a mask of AUTOPLAY_LEFT, AUTOPLAY_RIGHT and AUTOPLAY_LAUNCH.
+ */
+
+uint8_t autoplay_update( bat_t p_bat, const int8_t *p_balls )
+{
+  uint8_t   l_index, l_buttons = 0;
+  uint16_t  l_ticks, l_soonest = 0xffff;
+  fixed_t   l_column, l_landing = 0, l_target = p_bat.position;
+  bool      l_holding = false;
+  TRACE_SCOPE( "autoplay_update" );
+
+  /* Whichever ball will come down first is the one to worry about. */
+  for ( l_index = 0; l_index < MAX_BALLS; l_index++ )
+  {
+    if ( p_balls[l_index] < 0 )
+    {
+      continue;
+    }
+    if ( ball_predict( p_balls[l_index], p_bat, &l_column, &l_ticks ) )
+    {
+      if ( l_ticks < l_soonest )
+      {
+        l_soonest = l_ticks;
+        l_landing = l_column;
+      }
+    }
+    else if ( ball_stuck( p_balls[l_index] ) )
+    {
+      l_holding = true;
+    }
+  }
+
+  if ( l_soonest != 0xffff )
+  {
+    /* If it's further off than it was, it's bounced off something; take */
+    /* it on a different bit of the bat this time.                       */
+    if ( l_soonest > m_last_ticks + 2 )
+    {
+      _autoplay_aim( p_bat );
+    }
+    l_target = l_landing + m_offset;
+    m_held = 0;
+  }
+  else if ( l_holding )
+  {
+    /* A fresh ball; wander off somewhere, and then let it go. */
+    if ( m_held == 0 )
+    {
+      m_hold = FIXED_FROM_INT( ( p_bat.width / 2 ) + _autoplay_random( blit::fb.bounds.w - p_bat.width ) );
+    }
+    l_target = m_hold;
+    if ( ++m_held > AUTOPLAY_HOLD )
+    {
+      l_buttons |= AUTOPLAY_LAUNCH;
+      m_held = 0;
+    }
+  }
+  m_last_ticks = l_soonest;
+
+  /* We only get to act on what we thought a little while ago. */
+  m_targets[ m_tick % AUTOPLAY_DELAY_MAX ] = l_target;
+  l_target = m_targets[ ( m_tick - BLOX_AUTOPLAY_DELAY ) % AUTOPLAY_DELAY_MAX ];
+  m_tick++;
+
+  /* And steer towards it, without dithering once we're close enough. */
+  if ( l_target < p_bat.position - FIXED_ONE )
+  {
+    l_buttons |= AUTOPLAY_LEFT;
+  }
+  else if ( l_target > p_bat.position + FIXED_ONE )
+  {
+    l_buttons |= AUTOPLAY_RIGHT;
+  }
+  return l_buttons;
+}
+
+
+/*
+ * autoplay_end_game - called when a game the computer was playing is over.
+ *                     Soak builds go straight round again; otherwise, the
+ *                     bat goes back to the player.
+ *
+ * uint32_t - the final score
+ * uint8_t  - the level reached
+ */
+
+void autoplay_end_game( uint32_t p_score, uint8_t p_level )
+{
+  printf( "autoplay: game %lu over on level %u, scoring %lu\n",
+          (unsigned long)++m_games, p_level, (unsigned long)p_score );
+#ifndef BLOX_AUTOPLAY
+  m_active = false;
+#endif
+}
+
+
+/* End of autoplay.cpp */
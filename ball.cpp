@@ -6,6 +6,9 @@
  * of bounce. This is all kept separate from the game logic to cope with
  * multiball scenarios later on.
  *
+ * All the physics is done in Q16.16 fixed point rather than floats, so that
+ * the ball follows exactly the same path on the device as on the host.
+ *
  * Please note that this is a first attempt at understanding a somewhat fluid
  * API on a shiny new bit of kit, so it probably is not full of 'best practice'.
  * It will hopefully serve as some sort of starting point, however.
@@ -17,6 +20,8 @@
 
 /* System headers. */
 
+#include <stdio.h>
+#include <string.h>
 
 
 /* Local headers. */
@@ -25,319 +30,680 @@
 #include "32blox.hpp"
 
 
+/* Constants. */
+
+#define BALL_BOUNCE_SPEED     FIXED( 0.875f )   /* Speed off the bat.        */
+#define BALL_BOUNCE_SIDEWAYS  FIXED( 0.75f )    /* Most of that which can go */
+                                                /* sideways, at the very end. */
+#define BALL_DEFLECT_ENTRIES  64
+#define BALL_SUBSTEPS_MAX     4
+#define BALL_BENCH_MAX        1000
+#define BALL_BENCH_TICKS      100
+
+
 /* Module variables. */
 
-static struct { 
-  float     x;
-  float     y;
-  float     dx;
-  float     dy;
+typedef struct { 
+  fixed_t   x;
+  fixed_t   y;
+  fixed_t   dx;
+  fixed_t   dy;
   bool      stuck;
   bool      active;
-} m_balls[5];
+} ball_t;
+
+static ball_t   m_balls[MAX_BALLS];
+static uint8_t  m_ball_sprite = SPRITE_NONE;
+static size     m_ball_size;
+static uint32_t m_slow_ticks;                 /* Ticks left of a slow ball. */
+
+/* Substeps taken, for keeping an eye on what fast balls cost us. */
+static struct {
+  uint16_t  tick;                               /* So far, this tick.        */
+  uint16_t  peak;                               /* Most in any one tick.     */
+  uint32_t  total;
+  uint32_t  ticks;
+}               m_substeps;
+
+/* Outgoing velocity for each pixel along each type of bat. */
+static struct {
+  uint8_t   entries;
+  fixed_t   dx[BALL_DEFLECT_ENTRIES];
+  fixed_t   dy[BALL_DEFLECT_ENTRIES];
+}               m_deflections[BAT_MAX];
 
 
 /* Module functions. */
 
-static bool check_brick_hit( uint16_t p_row, uint16_t p_column, uint16_t p_newx, uint16_t p_newy )
+/*
+ * _ball_isqrt - integer square root, so that the deflection tables come out
+ *               the same everywhere.
+ *
+ * uint64_t - the value to root
+ *
+ * Returns the largest integer whose square doesn't exceed the value.
+ */
+
+static uint32_t _ball_isqrt( uint64_t p_value )
 {
-  uint8_t *l_bricks;
-  
-  /* Sanity check the arguments. */
-  if ( ( p_row >= 10 ) || ( p_column >= 10 ) )
+  uint64_t l_root = 0, l_bit = (uint64_t)1 << 62;
+
+  while ( l_bit > p_value )
+  {
+    l_bit >>= 2;
+  }
+  while ( l_bit != 0 )
+  {
+    if ( p_value >= l_root + l_bit )
+    {
+      p_value -= l_root + l_bit;
+      l_root = ( l_root >> 1 ) + l_bit;
+    }
+    else
+    {
+      l_root >>= 1;
+    }
+    l_bit >>= 2;
+  }
+  return (uint32_t)l_root;
+}
+
+
+/*
+ * _ball_deflections - (re)builds the deflection table for a bat, if its
+ *                     width has changed. Dead centre goes straight back up,
+ *                     and the angle opens out evenly towards either end.
+ *
+ * bat_t   - the bat in question
+ * uint8_t - the width of the ball
+ */
+
+static void _ball_deflections( bat_t p_bat, uint8_t p_ballwidth )
+{
+  uint8_t  l_entries, l_index;
+  int32_t  l_offset;
+  fixed_t  l_dy;
+
+  l_entries = p_bat.width + ( ( p_ballwidth / 2 ) * 2 );
+  if ( l_entries > BALL_DEFLECT_ENTRIES )
+  {
+    l_entries = BALL_DEFLECT_ENTRIES;
+  }
+  if ( ( p_bat.type >= BAT_MAX ) || ( m_deflections[p_bat.type].entries == l_entries ) )
+  {
+    return;
+  }
+
+  m_deflections[p_bat.type].entries = l_entries;
+  for ( l_index = 0; l_index < l_entries; l_index++ )
+  {
+    /* Offset from the centre, in half pixels, running -(n-1) to (n-1). */
+    l_offset = ( 2 * l_index ) - ( l_entries - 1 );
+    l_dy = ( l_entries > 1 ) ? ( (int64_t)BALL_BOUNCE_SIDEWAYS * l_offset ) / ( l_entries - 1 ) : 0;
+
+    m_deflections[p_bat.type].dy[l_index] = l_dy;
+    m_deflections[p_bat.type].dx[l_index] =
+      -(fixed_t)_ball_isqrt( ( (int64_t)BALL_BOUNCE_SPEED * BALL_BOUNCE_SPEED ) - ( (int64_t)l_dy * l_dy ) );
+  }
+}
+
+
+/*
+ * _ball_collide_pair - bounces two balls off each other if they're touching
+ *                      and heading together; they weigh the same, so they
+ *                      simply swap their speeds along the line between them.
+ *
+ * ball_t * - the first ball
+ * ball_t * - the second ball
+ * int64_t  - the square of the ball diameter, in Q32
+ *
+ * Returns bool, true if they bounced.
+ */
+
+static bool _ball_collide_pair( ball_t *p_first, ball_t *p_second, int64_t p_reach )
+{
+  fixed_t  l_nx, l_ny;
+  int64_t  l_distance, l_closing;
+  fixed_t  l_ix, l_iy;
+
+  l_nx = p_second->x - p_first->x;
+  l_ny = p_second->y - p_first->y;
+  l_distance = ( (int64_t)l_nx * l_nx ) + ( (int64_t)l_ny * l_ny );
+  if ( ( l_distance >= p_reach ) || ( l_distance == 0 ) )
   {
     return false;
   }
-  
-  /* Fetch the bricks. */
-  l_bricks = level_get_line( p_row );
-    
-  /* No hit where there is no brick. */
-  if ( l_bricks[p_column] == 0 )
+
+  /* If they're already moving apart, leave them to it. */
+  l_closing = ( (int64_t)( p_first->dx - p_second->dx ) * l_nx ) +
+              ( (int64_t)( p_first->dy - p_second->dy ) * l_ny );
+  if ( l_closing <= 0 )
   {
     return false;
   }
-  
-  /* Sprite collision check then. */
-  return sprite_collide( level_get_bricktype( l_bricks[p_column] ),
-                         p_column * 16, ( p_row * 8 ) + 10, ALIGN_TOPLEFT,
-                         "ball", p_newy, p_newx, ALIGN_MIDCENTRE );
+
+  l_ix = (fixed_t)( ( (int64_t)l_nx * l_closing ) / l_distance );
+  l_iy = (fixed_t)( ( (int64_t)l_ny * l_closing ) / l_distance );
+  p_first->dx -= l_ix;
+  p_first->dy -= l_iy;
+  p_second->dx += l_ix;
+  p_second->dy += l_iy;
+  return true;
 }
 
-/* Functions. */
+
+/*
+ * _ball_collide_set - resolves every ball-ball collision in a set of balls.
+ *                     The balls are dropped into the grid first, so each
+ *                     one is only tested against those in the same and the
+ *                     neighbouring cells.
+ *
+ * ball_t * - the balls
+ * uint16_t - how many of them there are
+ * uint8_t  - the diameter of a ball
+ *
+ * Returns the number of pairs tested, for benchmarking.
+ */
+
+static uint32_t _ball_collide_set( ball_t *p_balls, uint16_t p_count, uint8_t p_diameter )
+{
+  uint16_t l_index, l_other, l_cell, l_neighbour;
+  int8_t   l_across, l_down;
+  int64_t  l_reach;
+  uint32_t l_tests = 0;
+
+  l_reach = (int64_t)FIXED_FROM_INT( p_diameter ) * FIXED_FROM_INT( p_diameter );
+
+  /* Rebuild the grid from scratch; ball x is the row, y the column. */
+  grid_clear();
+  for ( l_index = 0; l_index < p_count; l_index++ )
+  {
+    if ( p_balls[l_index].active && !p_balls[l_index].stuck )
+    {
+      grid_insert( l_index, FIXED_INT( p_balls[l_index].y ), FIXED_INT( p_balls[l_index].x ) );
+    }
+  }
+
+  /* And check each ball against its neighbours, taking each pair just once. */
+  for ( l_index = 0; l_index < p_count; l_index++ )
+  {
+    if ( !p_balls[l_index].active || p_balls[l_index].stuck )
+    {
+      continue;
+    }
+    l_cell = grid_cell( FIXED_INT( p_balls[l_index].y ), FIXED_INT( p_balls[l_index].x ) );
+    for ( l_down = -1; ( l_cell != GRID_NONE ) && ( l_down <= 1 ); l_down++ )
+    {
+      for ( l_across = -1; l_across <= 1; l_across++ )
+      {
+        l_neighbour = grid_neighbour( l_cell, l_across, l_down );
+        for ( l_other = grid_first( l_neighbour ); l_other != GRID_NONE; l_other = grid_next( l_other ) )
+        {
+          if ( l_other > l_index )
+          {
+            l_tests++;
+            _ball_collide_pair( &p_balls[l_index], &p_balls[l_other], l_reach );
+          }
+        }
+      }
+    }
+  }
+  return l_tests;
+}
 
 
 /*
- * ball_create - generate a new player ball, on the player bat
+ * _ball_bricks_near - checks the level's row masks, to see if there are any
+ *                     bricks at all in the cells around a ball.
  *
- * bat_t - details of the player's bat
+ * uint8_t - the row the ball is in; board_rows() if it's just below them
+ * uint8_t - the column the ball is in; likewise, board_columns()
  *
- * Returns the ball ID of the new ball.
+ * Returns bool, true if there's anything there to hit.
  */
 
-uint8_t ball_create( bat_t p_bat )
+static bool _ball_bricks_near( uint8_t p_row, uint8_t p_column )
 {
-  uint8_t l_index;
-  size    l_ballsize = sprite_size( "ball" );
-  
-  /* Find an empty slot in the ball array. */
-  for ( l_index = 0; l_index < MAX_BALLS; l_index++ )
+  uint32_t l_rows, l_columns;
+  uint8_t  l_row;
+
+  if ( ( p_row == BOARD_OUTSIDE ) || ( p_column == BOARD_OUTSIDE ) )
   {
-    if ( !m_balls[l_index].active )
+    return false;
+  }
+
+  /* Any of the three rows, first of all... */
+  l_rows = ( p_row > 0 ) ? ( 7UL << ( p_row - 1 ) ) : 3UL;
+  if ( ( level_get_rows() & l_rows ) == 0 )
+  {
+    return false;
+  }
+
+  /* ...and then the three columns within those rows. */
+  l_columns = ( p_column > 0 ) ? ( 7UL << ( p_column - 1 ) ) : 3UL;
+  for ( l_row = ( p_row > 0 ) ? p_row - 1 : 0; l_row <= p_row + 1; l_row++ )
+  {
+    if ( ( level_get_row_mask( l_row ) & l_columns ) != 0 )
     {
-      break;
+      return true;
     }
   }
+  return false;
+}
+
+
+static bool check_brick_hit( uint16_t p_row, uint16_t p_column, uint16_t p_newx, uint16_t p_newy )
+{
+  uint8_t           *l_bricks;
+  const bricktype_t *l_type;
+  
+  /* Sanity check the arguments. */
+  if ( ( p_row >= board_rows() ) || ( p_column >= board_columns() ) )
+  {
+    return false;
+  }
   
-  /* If we didn't find a slot, we can't really do this. */
-  if ( l_index == MAX_BALLS )
+  /* Nothing to hit if the row has nothing in that column. */
+  if ( ( level_get_row_mask( p_row ) & ( 1UL << p_column ) ) == 0 )
   {
-    return MAX_BALLS;
+    return false;
   }
   
-  /* Good, so initiate the ball as stuck to the bat. */
-  m_balls[l_index].x = p_bat.baseline - ( ( l_ballsize.h+1 ) / 2 );
-  m_balls[l_index].y = p_bat.position;
-  m_balls[l_index].dx = m_balls[l_index].dy = 0;
-  m_balls[l_index].stuck = m_balls[l_index].active = true;
+  /* Fetch the bricks. */
+  l_bricks = level_get_line( p_row );
+    
+  /* No hit where there is no brick, or nothing solid to hit. */
+  l_type = level_get_bricktype( l_bricks[p_column] );
+  if ( ( l_type->flags & BRICK_FLAG_SOLID ) == 0 )
+  {
+    return false;
+  }
   
-  /* And return the new ball. */
-  return l_index;
-}
+  /* Full sized bricks can use a sprite collision check then... */
+  if ( board_full_size() )
+  {
+    return sprite_collide_id( l_type->sprite,
+                              board_left( p_column ), board_top( p_row ), ALIGN_TOPLEFT,
+                              m_ball_sprite, p_newy, p_newx, ALIGN_MIDCENTRE );
+  }
 
-uint8_t ball_spawn( uint8_t )
-{
-  /* __RETURN__ */
-  return 0;
+  /* ...but squeezed ones don't match their sprites, so are just boxes. */
+  return board_brick( p_row, p_column ).intersects(
+           rect( p_newy - ( m_ball_size.w / 2 ), p_newx - ( m_ball_size.h / 2 ), m_ball_size.w, m_ball_size.h ) );
 }
 
 
 /*
- * ball_update - updates the location of the ball, taking into account any
- *               potential bounces.
- * 
- * uint8_t - the ball ID being updated
- * bat_t   - the players bat details, potentially important
- * 
- * Returns any score that has been earned by the update, or -1 if the ball died.
+ * _ball_step - moves a ball in flight through one substep of a tick, taking
+ *              into account any potential bounces.
+ *
+ * ball_t *  - the ball being moved
+ * bat_t     - the players bat details
+ * uint8_t   - how many substeps the tick is split into
+ * size      - the size of the ball
+ *
+ * Returns any score earned by the step, or -1 if the ball died.
  */
 
-int8_t ball_update( uint8_t p_ballid, bat_t p_bat )
+static int8_t _ball_step( ball_t *p_ball, bat_t p_bat, uint8_t p_substeps, size p_ballsize )
 {
   uint8_t  l_score = 0;
   uint8_t  l_row, l_column;
   uint16_t l_newx, l_newy;
-  float    l_edge, l_speed;
-  size     l_ballsize = sprite_size( "ball" );
+  int16_t  l_contact;
   bool     l_bounced;
-  
-  /* Only active, valid balls need apply. */
-  if ( ( p_ballid < 0 ) || ( p_ballid >= MAX_BALLS ) || ( !m_balls[p_ballid].active ) )
-  {
-    return 0;
-  }
-  
-  /* If we're stuck to the bat, reflect that. */
-  if ( m_balls[p_ballid].stuck )
-  {
-    m_balls[p_ballid].y = p_bat.position;
-    return 0;
-  }
 
-  /* Then we're in free flight! First, calculate the new possible location. */
-  l_newx = m_balls[p_ballid].x + m_balls[p_ballid].dx;
-  l_newy = m_balls[p_ballid].y + m_balls[p_ballid].dy;
+  /* First, calculate the new possible location. */
+  l_newx = FIXED_INT( p_ball->x + ( p_ball->dx / p_substeps ) );
+  l_newy = FIXED_INT( p_ball->y + ( p_ball->dy / p_substeps ) );
   
   /* Check for hard boundaries on the play area itself. */
   if ( l_newx <= 10 ) 
   {
-    m_balls[p_ballid].dx *= -1.0f;
+    p_ball->dx = -p_ball->dx;
     l_score++;
   }
   if ( ( l_newy <= 0 ) || ( l_newy >= blit::fb.bounds.w ) )
   {
-    m_balls[p_ballid].dy *= -1.0f;
+    p_ball->dy = -p_ball->dy;
     l_score++;
   }
   
   /* If we've hit the bottom, though, we have bigger problems. */
   if ( l_newx >= blit::fb.bounds.h )
   {
-    m_balls[p_ballid].active = 0;
+    p_ball->active = 0;
     return -1;
   }
   
   /* See if we've dropped below the bat baseline. */
-  if ( ( ( l_newx + ( l_ballsize.h / 2 ) ) >= p_bat.baseline ) && 
-       ( ( m_balls[p_ballid].x + ( l_ballsize.h / 2 ) ) < p_bat.baseline ) )
+  if ( ( ( l_newx + ( p_ballsize.h / 2 ) ) >= p_bat.baseline ) && 
+       ( ( p_ball->x + FIXED_FROM_INT( p_ballsize.h / 2 ) ) < FIXED_FROM_INT( p_bat.baseline ) ) )
   {
-    /* Check to see if we hit the bat. */
-    if ( sprite_collide( "bat_normal", p_bat.position, p_bat.baseline, ALIGN_TOPCENTRE,
-                        "ball", l_newy, l_newx, ALIGN_MIDCENTRE ) )
+    /* Where along the bat did we land, counting from the ball's centre? */
+    l_contact = l_newy - FIXED_INT( p_bat.position - FIXED_FROM_INT( p_bat.width / 2 ) )
+              + ( p_ballsize.w / 2 );
+
+    /* If that's actually on the bat, bounce off at the angle for that spot. */
+    _ball_deflections( p_bat, p_ballsize.w );
+    if ( ( p_bat.type < BAT_MAX ) && ( l_contact >= 0 ) &&
+         ( l_contact < m_deflections[p_bat.type].entries ) )
     {
-      /* Bounce vertically, and score. */
-      m_balls[p_ballid].dx *= -1.0f;
+      p_ball->dx = m_deflections[p_bat.type].dx[l_contact];
+      p_ball->dy = m_deflections[p_bat.type].dy[l_contact];
       l_score++;
-      
-      /* Take into account edge shots, somehow... */
-      l_edge = ( l_newy + ( l_ballsize.w / 2 ) ) - ( p_bat.position - ( p_bat.width / 2 ) );
-      if ( l_edge < 5.0f )
-      {
-        m_balls[p_ballid].dy -= ( ( 5.0f - l_edge ) / 10.0f );
-      }
-
-      l_edge = ( p_bat.position + ( p_bat.width / 2 ) ) - ( l_newy - ( l_ballsize.w / 2 ) );
-      if ( l_edge < 5.0f )
-      {
-        m_balls[p_ballid].dy += ( ( 5.0f - l_edge ) / 10.0f );
-      }
     }
   }
   
-  /* Lastly, bricks. Nothing to do if we're below the play space. */
-  if ( ( ( l_newx - 10 ) / 8 ) < 10 )
+  /* Lastly, bricks. We need to know roughly where we are now; there's  */
+  /* nothing to do if we're below the play space, or if there's nothing */
+  /* left in the rows and columns around us.                            */
+  l_row = board_row( FIXED_INT( p_ball->x ) );
+  l_column = board_column( FIXED_INT( p_ball->y ) );
+  if ( ( l_newx < board_top( board_rows() ) ) && ( _ball_bricks_near( l_row, l_column ) ) )
   {
-    /* We need to know roughly where we are now. */
-    l_row = ( m_balls[p_ballid].x - 10 ) / 8;
-    l_column = m_balls[p_ballid].y / 16;
-    
     /* First, consider the row above us if we're moving up and not at the top. */
-    if ( ( m_balls[p_ballid].dx < 0 ) && ( l_row > 0 ) )
+    if ( ( p_ball->dx < 0 ) && ( l_row > 0 ) )
     {
       /* Check the three bricks above us. */
       l_bounced = false;
       if ( check_brick_hit( l_row - 1, l_column - 1, l_newx, l_newy ) )
       {
         l_bounced = true;
-        level_hit_brick( l_row - 1, l_column - 1 );
+        l_score += level_hit_brick( l_row - 1, l_column - 1 );
       }
       else if ( check_brick_hit( l_row - 1, l_column, l_newx, l_newy ) )
       {
         l_bounced = true;
-        level_hit_brick( l_row - 1, l_column );
+        l_score += level_hit_brick( l_row - 1, l_column );
       }
       else if ( check_brick_hit( l_row - 1, l_column + 1, l_newx, l_newy ) )
       {
         l_bounced = true;
-        level_hit_brick( l_row - 1, l_column + 1 );
+        l_score += level_hit_brick( l_row - 1, l_column + 1 );
       }
       
-      /* Lastly, bounce and score if we, well, bounced. */
+      /* Lastly, bounce if we, well, bounced. */
       if ( l_bounced )
       {
-        l_score += 10;
-        m_balls[p_ballid].dx *= -1.0f;
+        p_ball->dx = -p_ball->dx;
       }
     }
     
     /* Then the row below us, if we're moving down (and not off the bottom) */
-    if ( ( m_balls[p_ballid].dx > 0 ) && ( l_row < 9 ) )
+    if ( ( p_ball->dx > 0 ) && ( l_row < board_rows() - 1 ) )
     {
       /* Check the three bricks below us. */
       l_bounced = false;
       if ( check_brick_hit( l_row + 1, l_column - 1, l_newx, l_newy ) )
       {
         l_bounced = true;
-        level_hit_brick( l_row + 1, l_column - 1 );
+        l_score += level_hit_brick( l_row + 1, l_column - 1 );
       }
       else if ( check_brick_hit( l_row + 1, l_column, l_newx, l_newy ) )
       {
         l_bounced = true;
-        level_hit_brick( l_row + 1, l_column );
+        l_score += level_hit_brick( l_row + 1, l_column );
       }
       else if ( check_brick_hit( l_row + 1, l_column + 1, l_newx, l_newy ) )
       {
         l_bounced = true;
-        level_hit_brick( l_row + 1, l_column + 1 );
+        l_score += level_hit_brick( l_row + 1, l_column + 1 );
       }
       
-      /* Lastly, bounce and score if we, well, bounced. */
+      /* Lastly, bounce if we, well, bounced. */
       if ( l_bounced )
       {
-        l_score += 10;
-        m_balls[p_ballid].dx *= -1.0f;
+        p_ball->dx = -p_ball->dx;
       }
     }
     
     /* Now leftward collisions. */
-    if ( ( m_balls[p_ballid].dy < 0 ) && ( l_column > 0 ) )
+    if ( ( p_ball->dy < 0 ) && ( l_column > 0 ) )
     {
       /* Check the three bricks left us. */
       l_bounced = false;
       if ( check_brick_hit( l_row - 1, l_column - 1, l_newx, l_newy ) )
       {
         l_bounced = true;
-        level_hit_brick( l_row - 1, l_column - 1 );
+        l_score += level_hit_brick( l_row - 1, l_column - 1 );
       }
       else if ( check_brick_hit( l_row, l_column - 1, l_newx, l_newy ) )
       {
         l_bounced = true;
-        level_hit_brick( l_row, l_column - 1 );
+        l_score += level_hit_brick( l_row, l_column - 1 );
       }
       else if ( check_brick_hit( l_row + 1, l_column - 1, l_newx, l_newy ) )
       {
         l_bounced = true;
-        level_hit_brick( l_row + 1, l_column - 1 );
+        l_score += level_hit_brick( l_row + 1, l_column - 1 );
       }
       
-      /* Lastly, bounce and score if we, well, bounced. */
+      /* Lastly, bounce if we, well, bounced. */
       if ( l_bounced )
       {
-        l_score += 10;
-        m_balls[p_ballid].dy *= -1.0f;
+        p_ball->dy = -p_ball->dy;
       }
     }
     
     /* And finally, rightward collisions. */
-    if ( ( m_balls[p_ballid].dy > 0 ) && ( l_column < 15 ) )
+    if ( ( p_ball->dy > 0 ) && ( l_column < board_columns() - 1 ) )
     {
       /* Check the three bricks right us. */
       l_bounced = false;
       if ( check_brick_hit( l_row - 1, l_column + 1, l_newx, l_newy ) )
       {
         l_bounced = true;
-        level_hit_brick( l_row - 1, l_column + 1 );
+        l_score += level_hit_brick( l_row - 1, l_column + 1 );
       }
       else if ( check_brick_hit( l_row, l_column + 1, l_newx, l_newy ) )
       {
         l_bounced = true;
-        level_hit_brick( l_row, l_column + 1 );
+        l_score += level_hit_brick( l_row, l_column + 1 );
       }
       else if ( check_brick_hit( l_row + 1, l_column + 1, l_newx, l_newy ) )
       {
         l_bounced = true;
-        level_hit_brick( l_row + 1, l_column + 1 );
+        l_score += level_hit_brick( l_row + 1, l_column + 1 );
       }
       
-      /* Lastly, bounce and score if we, well, bounced. */
+      /* Lastly, bounce if we, well, bounced. */
       if ( l_bounced )
       {
-        l_score += 10;
-        m_balls[p_ballid].dy *= -1.0f;
+        p_ball->dy = -p_ball->dy;
       }
     }
   }
 
-  /* Lastly, check that the deltas haven't got *too* out of hand. */
-  l_speed = ( ( m_balls[p_ballid].dx * m_balls[p_ballid].dx ) +
-              ( m_balls[p_ballid].dy * m_balls[p_ballid].dy ) );
-  if ( l_speed > 0.9f )
+  /* Ok, move on by our share of the deltas and we're done. */
+  p_ball->x += p_ball->dx / p_substeps;
+  p_ball->y += p_ball->dy / p_substeps;
+  return l_score;
+}
+
+
+/* Functions. */
+
+
+/*
+ * ball_create - generate a new player ball, on the player bat
+ *
+ * bat_t - details of the player's bat
+ *
+ * Returns the ball ID of the new ball.
+ */
+
+uint8_t ball_create( bat_t p_bat )
+{
+  uint8_t l_index;
+  size    l_ballsize = sprite_size( "ball" );
+  
+  /* Look the ball sprite up once, rather than every time we draw it. */
+  m_ball_sprite = sprite_id( "ball" );
+  m_ball_size = l_ballsize;
+  
+  /* Find an empty slot in the ball array. */
+  for ( l_index = 0; l_index < MAX_BALLS; l_index++ )
+  {
+    if ( !m_balls[l_index].active )
+    {
+      break;
+    }
+  }
+  
+  /* If we didn't find a slot, we can't really do this. */
+  if ( l_index == MAX_BALLS )
+  {
+    return MAX_BALLS;
+  }
+  
+  /* Good, so initiate the ball as stuck to the bat. */
+  m_balls[l_index].x = FIXED_FROM_INT( p_bat.baseline - ( ( l_ballsize.h+1 ) / 2 ) );
+  m_balls[l_index].y = p_bat.position;
+  m_balls[l_index].dx = m_balls[l_index].dy = 0;
+  m_balls[l_index].stuck = m_balls[l_index].active = true;
+  
+  /* And return the new ball. */
+  return l_index;
+}
+
+
+/*
+ * ball_spawn - splits a new ball off an existing one in flight, heading off
+ *              sideways in the opposite direction.
+ *
+ * uint8_t - the ball ID to split
+ *
+ * Returns the ball ID of the new ball, or MAX_BALLS if it couldn't be done.
+ */
+
+uint8_t ball_spawn( uint8_t p_ballid )
+{
+  uint8_t l_index;
+
+  /* Only balls actually in flight can be split. */
+  if ( ( p_ballid >= MAX_BALLS ) || ( !m_balls[p_ballid].active ) || ( m_balls[p_ballid].stuck ) )
+  {
+    return MAX_BALLS;
+  }
+
+  /* Find an empty slot in the ball array. */
+  for ( l_index = 0; l_index < MAX_BALLS; l_index++ )
+  {
+    if ( !m_balls[l_index].active )
+    {
+      break;
+    }
+  }
+  if ( l_index == MAX_BALLS )
+  {
+    return MAX_BALLS;
+  }
+
+  /* Same place, same speed, mirrored sideways; the ball-ball collisions */
+  /* won't fight it, as they're already moving apart.                    */
+  m_balls[l_index] = m_balls[p_ballid];
+  m_balls[l_index].dy = -m_balls[p_ballid].dy;
+  if ( m_balls[l_index].dy == 0 )
+  {
+    m_balls[l_index].dy = FIXED( 0.25f );
+  }
+  return l_index;
+}
+
+
+/*
+ * ball_update - updates the location of the ball, taking into account any
+ *               potential bounces.
+ * 
+ * uint8_t - the ball ID being updated
+ * bat_t   - the players bat details, potentially important
+ * 
+ * Returns any score that has been earned by the update, or -1 if the ball died.
+ */
+
+int8_t ball_update( uint8_t p_ballid, bat_t p_bat )
+{
+  uint8_t  l_score = 0;
+  uint8_t  l_substeps, l_step;
+  int8_t   l_result;
+  fixed_t  l_speed, l_fastest, l_limit;
+  size     l_bricksize;
+  TRACE_SCOPE( "ball_update" );
+  
+  /* Only active, valid balls need apply. */
+  if ( ( p_ballid < 0 ) || ( p_ballid >= MAX_BALLS ) || ( !m_balls[p_ballid].active ) )
+  {
+    return 0;
+  }
+  
+  /* If we're stuck to the bat, reflect that. */
+  if ( m_balls[p_ballid].stuck )
+  {
+    m_balls[p_ballid].y = p_bat.position;
+    return 0;
+  }
+
+  /* Then we're in free flight! Split the tick up so that no step moves more */
+  /* than half the smallest thing we could hit, be it a ball or a brick.     */
+  l_bricksize = board_brick_size();
+  l_limit = FIXED_FROM_INT( ( m_ball_size.w < m_ball_size.h ) ? m_ball_size.w : m_ball_size.h );
+  if ( l_limit > FIXED_FROM_INT( l_bricksize.w ) )
+  {
+    l_limit = FIXED_FROM_INT( l_bricksize.w );
+  }
+  if ( l_limit > FIXED_FROM_INT( l_bricksize.h ) )
+  {
+    l_limit = FIXED_FROM_INT( l_bricksize.h );
+  }
+  l_limit /= 2;
+  l_fastest = ( m_balls[p_ballid].dx < 0 ) ? -m_balls[p_ballid].dx : m_balls[p_ballid].dx;
+  if ( l_fastest < ( ( m_balls[p_ballid].dy < 0 ) ? -m_balls[p_ballid].dy : m_balls[p_ballid].dy ) )
+  {
+    l_fastest = ( m_balls[p_ballid].dy < 0 ) ? -m_balls[p_ballid].dy : m_balls[p_ballid].dy;
+  }
+  l_substeps = ( l_limit > 0 ) ? 1 + ( ( l_fastest - 1 ) / l_limit ) : 1;
+  if ( l_substeps > BALL_SUBSTEPS_MAX )
+  {
+    l_substeps = BALL_SUBSTEPS_MAX;
+  }
+  if ( l_substeps < 1 )
+  {
+    l_substeps = 1;
+  }
+  m_substeps.tick += l_substeps;
+
+  for ( l_step = 0; l_step < l_substeps; l_step++ )
+  {
+    l_result = _ball_step( &m_balls[p_ballid], p_bat, l_substeps, m_ball_size );
+    if ( l_result < 0 )
+    {
+      return -1;
+    }
+    l_score += l_result;
+  }
+
+  /* Lastly, check that the deltas haven't got *too* out of hand; a slowed */
+  /* ball is held to a lower band, which the nudges will soon bring it to. */
+  l_speed = FIXED_MUL( m_balls[p_ballid].dx, m_balls[p_ballid].dx ) +
+            FIXED_MUL( m_balls[p_ballid].dy, m_balls[p_ballid].dy );
+  if ( m_slow_ticks > 0 )
+  {
+    l_speed *= 2;
+  }
+  if ( l_speed > FIXED( 0.9f ) )
   {
     /* Just nudge everything down a little. */
-    m_balls[p_ballid].dx *= 0.95f;
-    m_balls[p_ballid].dy *= 0.95f;
+    m_balls[p_ballid].dx = FIXED_MUL( m_balls[p_ballid].dx, FIXED( 0.95f ) );
+    m_balls[p_ballid].dy = FIXED_MUL( m_balls[p_ballid].dy, FIXED( 0.95f ) );
   }
-  if ( l_speed < 0.6f )
+  if ( l_speed < FIXED( 0.6f ) )
   {
     /* Just nudge everything up a little. */
-    m_balls[p_ballid].dx *= 1.05f;
-    m_balls[p_ballid].dy *= 1.05f;
+    m_balls[p_ballid].dx = FIXED_MUL( m_balls[p_ballid].dx, FIXED( 1.05f ) );
+    m_balls[p_ballid].dy = FIXED_MUL( m_balls[p_ballid].dy, FIXED( 1.05f ) );
   }
   
-  /* Ok, apply the new deltas then and we're done. */
-  m_balls[p_ballid].x += m_balls[p_ballid].dx;
-  m_balls[p_ballid].y += m_balls[p_ballid].dy;
-  
   /* And return the new ball location; probably not needed for now... */
   return l_score;
 }
@@ -358,7 +724,8 @@ void ball_render( uint8_t p_ballid )
   }
   
   /* So simply draw the ball sprite in. */
-  sprite_render( "ball", m_balls[p_ballid].y, m_balls[p_ballid].x, ALIGN_MIDCENTRE );
+  sprite_render_id( m_ball_sprite, FIXED_INT( m_balls[p_ballid].y ),
+                    FIXED_INT( m_balls[p_ballid].x ), ALIGN_MIDCENTRE );
 }
 
 
@@ -378,8 +745,8 @@ void ball_launch( uint8_t p_ballid )
   }
   
   /* So, all we really do is create a slightly random vector to release on. */
-  m_balls[p_ballid].dx = -0.75f;
-  m_balls[p_ballid].dy = -0.5f + ( ( blit::random() % 100 ) / 100.0f );
+  m_balls[p_ballid].dx = FIXED( -0.75f );
+  m_balls[p_ballid].dy = FIXED( -0.5f ) + ( (fixed_t)random_range( 100 ) * FIXED_ONE ) / 100;
   m_balls[p_ballid].stuck = false;
 }
 
@@ -403,4 +770,276 @@ bool ball_stuck( uint8_t p_ballid )
 }
 
 
+/*
+ * ball_predict - works out where a ball in flight will come down to the bat,
+ *                allowing for bounces off the walls and the top, but not
+ *                for any bricks in the way. Only the ball's direction is
+ *                needed for where, so speed changes on the way don't matter.
+ *
+ * uint8_t    - the ball ID
+ * bat_t      - the player's bat
+ * fixed_t *  - where to put the column (y) it'll land at
+ * uint16_t * - where to put roughly how many ticks until it does
+ *
+ * Returns bool, true if the ball is in flight and a prediction was made.
+ */
+
+bool ball_predict( uint8_t p_ballid, bat_t p_bat, fixed_t *p_column, uint16_t *p_ticks )
+{
+  fixed_t l_landing, l_top, l_fall, l_speed, l_width, l_column;
+
+  if ( ( p_ballid >= MAX_BALLS ) || ( !m_balls[p_ballid].active ) ||
+       ( m_balls[p_ballid].stuck ) || ( m_balls[p_ballid].dx == 0 ) )
+  {
+    return false;
+  }
+
+  /* How far it has to go down (or up and back down) to reach the bat. */
+  l_landing = FIXED_FROM_INT( p_bat.baseline - ( m_ball_size.h / 2 ) );
+  l_top = FIXED_FROM_INT( 10 );
+  l_speed = m_balls[p_ballid].dx;
+  if ( l_speed > 0 )
+  {
+    l_fall = l_landing - m_balls[p_ballid].x;
+  }
+  else
+  {
+    l_speed = -l_speed;
+    l_fall = ( m_balls[p_ballid].x - l_top ) + ( l_landing - l_top );
+  }
+  if ( l_fall < 0 )
+  {
+    return false;
+  }
+
+  /* Sideways, it goes as far in proportion; then fold that back into the */
+  /* screen, as a bounce off either wall is just a reflection.            */
+  l_width = FIXED_FROM_INT( blit::fb.bounds.w );
+  l_column = m_balls[p_ballid].y + (fixed_t)( ( (int64_t)m_balls[p_ballid].dy * l_fall ) / l_speed );
+  l_column %= 2 * l_width;
+  if ( l_column < 0 )
+  {
+    l_column += 2 * l_width;
+  }
+  if ( l_column > l_width )
+  {
+    l_column = ( 2 * l_width ) - l_column;
+  }
+
+  *p_column = l_column;
+  *p_ticks = l_fall / l_speed;
+  return true;
+}
+
+
+/*
+ * ball_reset - takes every ball out of play, at the start of a game or a
+ *              level; with multiball, there could be several still about.
+ */
+
+void ball_reset( void )
+{
+  uint8_t l_index;
+
+  for ( l_index = 0; l_index < MAX_BALLS; l_index++ )
+  {
+    m_balls[l_index].active = false;
+  }
+  m_slow_ticks = 0;
+}
+
+
+/*
+ * ball_slow - slows all the balls down for a while.
+ *
+ * uint32_t - how long for, in ticks
+ */
+
+void ball_slow( uint32_t p_ticks )
+{
+  m_slow_ticks = p_ticks;
+}
+
+
+/*
+ * ball_save - writes every ball into a snapshot image, along with how much
+ *             longer they're slowed for.
+ *
+ * uint8_t * - where to write it
+ *
+ * Returns the number of bytes written.
+ */
+
+uint16_t ball_save( uint8_t *p_image )
+{
+  uint16_t l_length = 0;
+  uint8_t  l_index;
+
+  for ( l_index = 0; l_index < MAX_BALLS; l_index++ )
+  {
+    l_length += snapshot_put_32( &p_image[l_length], m_balls[l_index].x );
+    l_length += snapshot_put_32( &p_image[l_length], m_balls[l_index].y );
+    l_length += snapshot_put_32( &p_image[l_length], m_balls[l_index].dx );
+    l_length += snapshot_put_32( &p_image[l_length], m_balls[l_index].dy );
+    p_image[l_length++] = m_balls[l_index].stuck;
+    p_image[l_length++] = m_balls[l_index].active;
+  }
+  l_length += snapshot_put_32( &p_image[l_length], m_slow_ticks );
+  return l_length;
+}
+
+
+/*
+ * ball_restore - puts the balls back the way ball_save found them.
+ *
+ * const uint8_t * - the image to read from
+ *
+ * Returns the number of bytes read.
+ */
+
+uint16_t ball_restore( const uint8_t *p_image )
+{
+  uint16_t l_length = 0;
+  uint8_t  l_index;
+
+  for ( l_index = 0; l_index < MAX_BALLS; l_index++ )
+  {
+    m_balls[l_index].x = snapshot_get_32( &p_image[l_length] );
+    m_balls[l_index].y = snapshot_get_32( &p_image[l_length + 4] );
+    m_balls[l_index].dx = snapshot_get_32( &p_image[l_length + 8] );
+    m_balls[l_index].dy = snapshot_get_32( &p_image[l_length + 12] );
+    m_balls[l_index].stuck = p_image[l_length + 16];
+    m_balls[l_index].active = p_image[l_length + 17];
+    l_length += 18;
+  }
+  m_slow_ticks = snapshot_get_32( &p_image[l_length] );
+  return l_length + 4;
+}
+
+
+/*
+ * ball_end_tick - called once all the balls have been updated for a tick, to
+ *                 close off the substep count for it, and to count down any
+ *                 slowing.
+ */
+
+void ball_end_tick( void )
+{
+  if ( m_slow_ticks > 0 )
+  {
+    m_slow_ticks--;
+  }
+
+  if ( m_substeps.tick > m_substeps.peak )
+  {
+    m_substeps.peak = m_substeps.tick;
+  }
+  m_substeps.total += m_substeps.tick;
+  m_substeps.ticks++;
+  m_substeps.tick = 0;
+}
+
+
+/*
+ * ball_substeps - reports on the substeps taken so far.
+ *
+ * uint16_t * - where to put the most taken in a single tick
+ *
+ * Returns the average substeps per tick, in Q16.16.
+ */
+
+fixed_t ball_substeps( uint16_t *p_peak )
+{
+  if ( p_peak != NULL )
+  {
+    *p_peak = m_substeps.peak;
+  }
+  if ( m_substeps.ticks == 0 )
+  {
+    return 0;
+  }
+  return (fixed_t)( ( (int64_t)m_substeps.total << FIXED_SHIFT ) / m_substeps.ticks );
+}
+
+
+/*
+ * ball_collide_all - bounces any balls in play off each other.
+ */
+
+void ball_collide_all( void )
+{
+  TRACE_SCOPE( "ball_collide_all" );
+  _ball_collide_set( m_balls, MAX_BALLS, m_ball_size.w );
+}
+
+
+#ifdef BLOX_BENCH
+
+/*
+ * ball_bench - times ball-ball collisions for ever bigger swarms of balls,
+ *              bouncing around the screen.
+ */
+
+void ball_bench( void )
+{
+  static ball_t   ls_swarm[BALL_BENCH_MAX];
+  const uint16_t  l_counts[] = { 5, 10, 50, 100, 250, 500, 1000 };
+  uint8_t         l_run, l_diameter = sprite_size( "ball" ).w;
+  uint16_t        l_index, l_tick;
+  uint32_t        l_start, l_elapsed, l_tests;
+
+  for ( l_run = 0; l_run < sizeof( l_counts ) / sizeof( l_counts[0] ); l_run++ )
+  {
+    /* Scatter the balls about, heading in random directions. */
+    arena_reset();
+    if ( !grid_create( l_counts[l_run] ) )
+    {
+      printf( "bench: no room for a grid of %u balls\n", l_counts[l_run] );
+      break;
+    }
+    for ( l_index = 0; l_index < l_counts[l_run]; l_index++ )
+    {
+      ls_swarm[l_index].x = FIXED_FROM_INT( blit::random() % blit::fb.bounds.h );
+      ls_swarm[l_index].y = FIXED_FROM_INT( blit::random() % blit::fb.bounds.w );
+      ls_swarm[l_index].dx = (fixed_t)( blit::random() % FIXED_ONE ) - ( FIXED_ONE / 2 );
+      ls_swarm[l_index].dy = (fixed_t)( blit::random() % FIXED_ONE ) - ( FIXED_ONE / 2 );
+      ls_swarm[l_index].active = true;
+      ls_swarm[l_index].stuck = false;
+    }
+
+    /* Then let them bounce around for a while. */
+    l_tests = 0;
+    l_start = blit::now();
+    for ( l_tick = 0; l_tick < BALL_BENCH_TICKS; l_tick++ )
+    {
+      for ( l_index = 0; l_index < l_counts[l_run]; l_index++ )
+      {
+        ls_swarm[l_index].x += ls_swarm[l_index].dx;
+        ls_swarm[l_index].y += ls_swarm[l_index].dy;
+        if ( ( ls_swarm[l_index].x < 0 ) || ( ls_swarm[l_index].x >= FIXED_FROM_INT( blit::fb.bounds.h ) ) )
+        {
+          ls_swarm[l_index].dx = -ls_swarm[l_index].dx;
+          ls_swarm[l_index].x += ls_swarm[l_index].dx;
+        }
+        if ( ( ls_swarm[l_index].y < 0 ) || ( ls_swarm[l_index].y >= FIXED_FROM_INT( blit::fb.bounds.w ) ) )
+        {
+          ls_swarm[l_index].dy = -ls_swarm[l_index].dy;
+          ls_swarm[l_index].y += ls_swarm[l_index].dy;
+        }
+      }
+      l_tests += _ball_collide_set( ls_swarm, l_counts[l_run], l_diameter );
+    }
+    l_elapsed = blit::now() - l_start;
+
+    printf( "bench: %4u balls, %6lu us/tick, %7lu pair tests/tick (all-pairs would be %lu)\n",
+            l_counts[l_run], (unsigned long)( ( l_elapsed * 1000 ) / BALL_BENCH_TICKS ),
+            (unsigned long)( l_tests / BALL_BENCH_TICKS ),
+            (unsigned long)l_counts[l_run] * ( l_counts[l_run] - 1 ) / 2 );
+  }
+  arena_reset();
+}
+
+#endif /* BLOX_BENCH */
+
+
 /* End of ball.cpp */
@@ -0,0 +1,52 @@
+/*
+ * bench.cpp - part of 32Blox, a breakout game for the 32blit built to
+ * explore the API.
+ *
+ * Benchmarks, only built in when BLOX_BENCH is defined. They all run once at
+ * startup, before the splash screen, and print their results; each module
+ * looks after its own measurements, this just runs them in turn.
+ *
+ * Please note that this is a first attempt at understanding a somewhat fluid
+ * API on a shiny new bit of kit, so it probably is not full of 'best practice'.
+ * It will hopefully serve as some sort of starting point, however.
+ *
+ * Coyright (C) 2020 Pete Favelle <pete@fsquared.co.uk>
+ *
+ * This software is provided under the MIT License. See LICENSE.txt for details.
+ */
+
+#ifdef BLOX_BENCH
+
+/* System headers. */
+
+#include <stdio.h>
+
+
+/* Local headers. */
+
+#include "32blit.hpp"
+#include "32blox.hpp"
+
+
+/* Functions. */
+
+/*
+ * bench_run - runs every benchmark we have.
+ */
+
+void bench_run( void )
+{
+  printf( "bench: ball-ball collisions\n" );
+  ball_bench();
+
+  printf( "bench: board frame cost\n" );
+  game_bench();
+
+  /* Leave the arena as we found it, for the first state. */
+  arena_reset();
+}
+
+#endif /* BLOX_BENCH */
+
+
+/* End of bench.cpp */
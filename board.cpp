@@ -0,0 +1,227 @@
+/*
+ * board.cpp - part of 32Blox, a breakout game for the 32blit built to
+ * explore the API.
+ *
+ * The geometry of the board; where it sits on the screen, how big each brick
+ * is, and how many of them there are. Everyone who needs to turn a pixel into
+ * a brick (or the other way around) asks here, and the answers are worked out
+ * into tables once per level, so the ball never has to divide to find out
+ * which brick it's next to.
+ *
+ * Boards can be anything up to BOARD_MAX_COLUMNS by BOARD_MAX_ROWS; bricks are
+ * full sized if they fit, and squeezed down to share out the space if not.
+ *
+ * Please note that this is a first attempt at understanding a somewhat fluid
+ * API on a shiny new bit of kit, so it probably is not full of 'best practice'.
+ * It will hopefully serve as some sort of starting point, however.
+ *
+ * Coyright (C) 2020 Pete Favelle <pete@fsquared.co.uk>
+ *
+ * This software is provided under the MIT License. See LICENSE.txt for details.
+ */
+
+/* System headers. */
+
+#include <string.h>
+
+
+/* Local headers. */
+
+#include "32blit.hpp"
+#include "32blox.hpp"
+
+
+/* Constants. */
+
+#define BOARD_BRICK_WIDTH   16                   /* Full size, as the sprites. */
+#define BOARD_BRICK_HEIGHT  8
+#define BOARD_AREA_HEIGHT   80                   /* Ten full sized rows.       */
+#define BOARD_LEFT          0
+#define BOARD_TOP           ( HUD_HEIGHT + 1 )   /* Just under the HUD line.   */
+
+
+/* Module variables. */
+
+static uint8_t      m_columns, m_rows;
+static uint8_t      m_brick_width, m_brick_height;
+static uint8_t      m_column_of[BOARD_PIXELS];      /* Pixel column to brick. */
+static uint8_t      m_row_of[BOARD_PIXELS];         /* Pixel row to brick.    */
+static int16_t      m_left[BOARD_MAX_COLUMNS + 1];  /* Brick to pixel column. */
+static int16_t      m_top[BOARD_MAX_ROWS + 1];      /* Brick to pixel row.    */
+
+
+/* Functions. */
+
+/*
+ * board_init - sets up the board geometry, and the lookup tables to go with
+ *              it. Called by the level, whenever a new one starts.
+ *
+ * uint8_t - the number of bricks across the board
+ * uint8_t - the number of bricks down the board
+ */
+
+void board_init( uint8_t p_columns, uint8_t p_rows )
+{
+  uint8_t l_index;
+  int16_t l_pixel;
+
+  m_columns = ( p_columns > BOARD_MAX_COLUMNS ) ? BOARD_MAX_COLUMNS : p_columns;
+  m_rows = ( p_rows > BOARD_MAX_ROWS ) ? BOARD_MAX_ROWS : p_rows;
+
+  /* Full sized bricks if they fit, otherwise share out what space there is. */
+  m_brick_width = BOARD_BRICK_WIDTH;
+  if ( ( m_columns > 0 ) && ( m_columns * BOARD_BRICK_WIDTH > blit::fb.bounds.w ) )
+  {
+    m_brick_width = blit::fb.bounds.w / m_columns;
+  }
+  m_brick_height = BOARD_BRICK_HEIGHT;
+  if ( ( m_rows > 0 ) && ( m_rows * BOARD_BRICK_HEIGHT > BOARD_AREA_HEIGHT ) )
+  {
+    m_brick_height = BOARD_AREA_HEIGHT / m_rows;
+  }
+
+  /* Where each brick starts; one past the end marks where the board ends. */
+  for ( l_index = 0; l_index <= m_columns; l_index++ )
+  {
+    m_left[l_index] = BOARD_LEFT + ( l_index * m_brick_width );
+  }
+  for ( l_index = 0; l_index <= m_rows; l_index++ )
+  {
+    m_top[l_index] = BOARD_TOP + ( l_index * m_brick_height );
+  }
+
+  /* And which brick each pixel falls in, if any. A brick's worth past the */
+  /* last column and row counts as one more, so that a ball just about to  */
+  /* come onto the board can still see the bricks it's heading for.        */
+  memset( m_column_of, BOARD_OUTSIDE, sizeof( m_column_of ) );
+  memset( m_row_of, BOARD_OUTSIDE, sizeof( m_row_of ) );
+  for ( l_index = 0; l_index <= m_columns; l_index++ )
+  {
+    for ( l_pixel = m_left[l_index]; ( l_pixel < m_left[l_index] + m_brick_width ) && ( l_pixel < BOARD_PIXELS ); l_pixel++ )
+    {
+      m_column_of[l_pixel] = l_index;
+    }
+  }
+  for ( l_index = 0; l_index <= m_rows; l_index++ )
+  {
+    for ( l_pixel = m_top[l_index]; ( l_pixel < m_top[l_index] + m_brick_height ) && ( l_pixel < BOARD_PIXELS ); l_pixel++ )
+    {
+      m_row_of[l_pixel] = l_index;
+    }
+  }
+}
+
+
+/*
+ * board_columns - returns the number of bricks across the board.
+ */
+
+uint8_t board_columns( void )
+{
+  return m_columns;
+}
+
+
+/*
+ * board_rows - returns the number of bricks down the board.
+ */
+
+uint8_t board_rows( void )
+{
+  return m_rows;
+}
+
+
+/*
+ * board_column - finds the brick column a pixel column falls in.
+ *
+ * int16_t - the pixel column (x)
+ *
+ * Returns the brick column, board_columns() just past the right hand edge,
+ * or BOARD_OUTSIDE if it's off the board.
+ */
+
+uint8_t board_column( int16_t p_x )
+{
+  return ( ( p_x < 0 ) || ( p_x >= BOARD_PIXELS ) ) ? BOARD_OUTSIDE : m_column_of[p_x];
+}
+
+
+/*
+ * board_row - finds the brick row a pixel row falls in.
+ *
+ * int16_t - the pixel row (y)
+ *
+ * Returns the brick row, board_rows() just below the bottom edge, or
+ * BOARD_OUTSIDE if it's off the board.
+ */
+
+uint8_t board_row( int16_t p_y )
+{
+  return ( ( p_y < 0 ) || ( p_y >= BOARD_PIXELS ) ) ? BOARD_OUTSIDE : m_row_of[p_y];
+}
+
+
+/*
+ * board_left - returns the pixel column a brick column starts at; asking for
+ *              the column just past the last one gives the right hand edge.
+ *
+ * uint8_t - the brick column
+ */
+
+int16_t board_left( uint8_t p_column )
+{
+  return m_left[ ( p_column > m_columns ) ? m_columns : p_column ];
+}
+
+
+/*
+ * board_top - returns the pixel row a brick row starts at; asking for the row
+ *             just past the last one gives the bottom edge.
+ *
+ * uint8_t - the brick row
+ */
+
+int16_t board_top( uint8_t p_row )
+{
+  return m_top[ ( p_row > m_rows ) ? m_rows : p_row ];
+}
+
+
+/*
+ * board_brick - returns the rectangle a brick occupies on screen.
+ *
+ * uint8_t - the brick row
+ * uint8_t - the brick column
+ */
+
+rect board_brick( uint8_t p_row, uint8_t p_column )
+{
+  return rect( board_left( p_column ), board_top( p_row ), m_brick_width, m_brick_height );
+}
+
+
+/*
+ * board_brick_size - returns the size of a brick on this board.
+ */
+
+size board_brick_size( void )
+{
+  return size( m_brick_width, m_brick_height );
+}
+
+
+/*
+ * board_full_size - reports if the bricks are full sized, in which case they
+ *                   can be drawn with their sprites.
+ *
+ * Returns bool, true for full sized bricks.
+ */
+
+bool board_full_size( void )
+{
+  return ( m_brick_width == BOARD_BRICK_WIDTH ) && ( m_brick_height == BOARD_BRICK_HEIGHT );
+}
+
+
+/* End of board.cpp */
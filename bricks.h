@@ -0,0 +1,22 @@
+/*
+ * bricks.h - this is an auto-generated asset file. Please do not edit!
+ */
+
+static const struct {
+  const char *sprite;
+  uint8_t     score;
+  uint8_t     flags;
+  uint8_t     debris[3];                      /* RGB of the bits it sheds. */
+} m_brickdefs[BRICK_TYPES] =
+{
+  { NULL, 0, 0, { 0, 0, 0 } },
+  { "brick_red", 10, BRICK_FLAG_SOLID, { 255, 0, 0 } },
+  { "brick_orange", 10, BRICK_FLAG_SOLID, { 255, 128, 0 } },
+  { "brick_yellow", 10, BRICK_FLAG_SOLID, { 255, 255, 0 } },
+  { "brick_yellow", 10, BRICK_FLAG_SOLID, { 255, 255, 0 } },
+  { "brick_yellow", 10, BRICK_FLAG_SOLID, { 255, 255, 0 } },
+  { "brick_yellow", 10, BRICK_FLAG_SOLID, { 255, 255, 0 } },
+  { "brick_yellow", 10, BRICK_FLAG_SOLID, { 255, 255, 0 } },
+  { "brick_yellow", 10, BRICK_FLAG_SOLID, { 255, 255, 0 } },
+  { "brick_yellow", 10, BRICK_FLAG_SOLID, { 255, 255, 0 } }
+};
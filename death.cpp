@@ -30,48 +30,52 @@
 
 /* Module variables. */
 
-static blit::rgba   m_text_colour;
-static uint16_t     m_gradient_row;
 static uint32_t     m_score;
 static char         m_player[3];
 static uint8_t      m_cursor;
 static uint32_t     m_waiting;
-static blit::timer  m_wait_timer, m_flicker_timer;
+static uint8_t      m_wait_timer = SCHEDULE_NONE;
+static bee_font_t   m_outline_font, m_minimal_font;
+static rgba        *m_gradient;
+static bool         m_backdrop;
+static uint32_t     m_generation;
+static bool         m_redraw;
 
 
 /* Module functions. */
 
 /*
- * _death_wait_timer_update - a callback simply to set the waiting flag to false
+ * _death_decorate - draws everything on the screen which never moves.
  */
 
-void _death_wait_timer_update( blit::timer &p_timer )
+static void _death_decorate( void )
 {
-    m_waiting = false;
-    p_timer.stop();
+  /* Frame everything with bricks; we're a brick game after all! */
+  sprite_render( "brick_yellow", 0, 0 );
+  sprite_render( "brick_yellow", 16, 0 );
+  sprite_render( "brick_yellow", 0, 8 );
+
+  sprite_render( "brick_yellow", 128, 0 );
+  sprite_render( "brick_yellow", 144, 0 );
+  sprite_render( "brick_yellow", 144, 8 );
+  
+  sprite_render( "brick_yellow", 0, 112 );
+  sprite_render( "brick_yellow", 16, 112 );
+  sprite_render( "brick_yellow", 0, 104 );
+
+  sprite_render( "brick_yellow", 128, 112 );
+  sprite_render( "brick_yellow", 144, 112 );
+  sprite_render( "brick_yellow", 144, 104 );
 }
 
 
 /*
- * _death_flicker_timer_update - callback for the font flicker and background
+ * _death_wait_timer_update - a callback simply to set the waiting flag to false
  */
 
-void _death_flicker_timer_update( blit::timer &p_timer )
+static void _death_wait_timer_update( uint8_t p_timer )
 {
-  static uint16_t ls_loopcount = 0;
-  
-  /* Update the text colour used for flickeringness. */
-  if ( ( ls_loopcount += 25 ) > 1200 ) 
-  {
-    ls_loopcount = 0;
-  }
-  m_text_colour = blit::rgba( 
-                              ls_loopcount % 255, 
-                              ( ls_loopcount % 512 ) / 2, 
-                              255 - ( ls_loopcount % 255 ),
-                              255
-                            );
-  m_gradient_row = ( ls_loopcount / 10 ) % 120;
+    m_waiting = false;
 }
 
 
@@ -90,10 +94,7 @@ bool death_check_score( uint32_t p_score )
   /* Check this against the hiscore. */
   if ( hiscore_get_score( MAX_SCORES-1 ) < p_score )
   {
-    m_wait_timer.init( _death_wait_timer_update, 250, 0 );
     m_score = p_score;
-    m_player[0] = m_player[1] = m_player[2] = 'A';
-    m_cursor = 0;
     return true;
   }
   
@@ -102,6 +103,56 @@ bool death_check_score( uint32_t p_score )
 }
 
 
+/*
+ * death_enter - called when we start asking for the player's name.
+ */
+
+void death_enter( void )
+{
+  /* Start with a blank(ish) name. */
+  m_player[0] = m_player[1] = m_player[2] = 'A';
+  m_cursor = 0;
+  m_waiting = false;
+  
+  /* We need a timer to stop the cursor racing away. */
+  m_wait_timer = schedule_create( _death_wait_timer_update, 250, 1 );
+  
+  /* Get hold of the fonts in our new renderer. */
+  memcpy( &m_outline_font, bee_text_create_fixed_font( outline_font ), sizeof( bee_font_t ) );
+  memcpy( &m_minimal_font, bee_text_create_fixed_font( minimal_font ), sizeof( bee_font_t ) );
+  
+  /* The background gradient never changes shape, so work it out just once. */
+  m_gradient = effect_gradient_create();
+  
+  /* Nor does the frame, so draw it into an indexed backdrop if we can. */
+  m_backdrop = effect_backdrop_create( m_gradient );
+  if ( m_backdrop )
+  {
+    sprite_target_indexed( true );
+    _death_decorate();
+    sprite_target_indexed( false );
+  }
+  
+  /* And start things flickering; the first frame always needs drawing. */
+  effect_flicker_start();
+  m_redraw = true;
+}
+
+
+/*
+ * death_exit - called when the name is entered, to tidy up.
+ */
+
+void death_exit( void )
+{
+  schedule_stop( m_wait_timer );
+  effect_flicker_stop();
+  m_gradient = NULL;
+  m_backdrop = false;
+  indexed_release();
+}
+
+
 /*
  * death_update - process the used inputting their name.
  *
@@ -113,13 +164,6 @@ gamestate_t death_update( void )
 {
   bool l_moving = false;
   
-  /* If it's not running, we need to set up the flicker timer. */
-  if ( !m_flicker_timer.started )
-  {
-    m_flicker_timer.init( _death_flicker_timer_update, 20, -1 );
-    m_flicker_timer.start();
-  }
-  
   /* Move the cursor left. */
   if ( ( blit::pressed( blit::button::DPAD_LEFT ) ) || ( blit::joystick.x < -0.1f ) )
   {
@@ -133,7 +177,8 @@ gamestate_t death_update( void )
       if ( m_cursor > 0 )
       {
         m_waiting = true;
-        m_wait_timer.start();
+        m_redraw = true;
+        schedule_start( m_wait_timer );
         m_cursor--;
       }
     }
@@ -152,7 +197,8 @@ gamestate_t death_update( void )
       if ( m_cursor < 2 )
       {
         m_waiting = true;
-        m_wait_timer.start();
+        m_redraw = true;
+        schedule_start( m_wait_timer );
         m_cursor++;
       }
     }
@@ -171,7 +217,8 @@ gamestate_t death_update( void )
       if ( m_player[m_cursor] < 'Z' )
       {
         m_waiting = true;
-        m_wait_timer.start();
+        m_redraw = true;
+        schedule_start( m_wait_timer );
         m_player[m_cursor]++;
       }
     }
@@ -190,7 +237,8 @@ gamestate_t death_update( void )
       if ( m_player[m_cursor] > ' ' )
       {
         m_waiting = true;
-        m_wait_timer.start();
+        m_redraw = true;
+        schedule_start( m_wait_timer );
         m_player[m_cursor]--;
       }
     }
@@ -207,7 +255,6 @@ gamestate_t death_update( void )
   {
     /* Save this, and take the user into the hi score table. */
     hiscore_save_score( m_score, m_player );
-    m_flicker_timer.stop();
     return STATE_HISCORE;
   }
   
@@ -218,53 +265,37 @@ gamestate_t death_update( void )
 
 /* 
  * death_render - draw the player as she enters her name.
+ *
+ * Returns bool, true if anything was drawn.
  */
 
-void death_render( void )
+bool death_render( void )
 {
-  uint16_t    l_row;
   bee_point_t l_point;
-  bee_font_t  l_outline_font, l_minimal_font;
   
-  /* Clear the screen to a nice shifting gradient. */
-  for( l_row = 0; l_row < blit::fb.bounds.h; l_row++ )
+  /* If nothing has moved since last time, the screen is still good. */
+  if ( ( !m_redraw ) && ( m_generation == effect_generation() ) )
   {
-    blit::fb.pen( 
-      blit::rgba( 
-        (int)( 64.0f + 48.0f * ( sin( M_PI * 2 / blit::fb.bounds.h * l_row  ) ) ), 
-        0, 
-        (int)( 64.0f + 48.0f * ( cos( M_PI * 2 / blit::fb.bounds.h * l_row ) ) ), 
-        255 
-      )
-    );
-    blit::fb.line( point( 0, ( l_row + m_gradient_row ) % blit::fb.bounds.h ), 
-             point( blit::fb.bounds.w, ( l_row + m_gradient_row ) % blit::fb.bounds.h ) );
+    return false;
   }
+  m_redraw = false;
+  m_generation = effect_generation();
   
-  /* Frame everything with bricks; we're a brick game after all! */
-  sprite_render( "brick_yellow", 0, 0 );
-  sprite_render( "brick_yellow", 16, 0 );
-  sprite_render( "brick_yellow", 0, 8 );
-
-  sprite_render( "brick_yellow", 128, 0 );
-  sprite_render( "brick_yellow", 144, 0 );
-  sprite_render( "brick_yellow", 144, 8 );
-  
-  sprite_render( "brick_yellow", 0, 112 );
-  sprite_render( "brick_yellow", 16, 112 );
-  sprite_render( "brick_yellow", 0, 104 );
-
-  sprite_render( "brick_yellow", 128, 112 );
-  sprite_render( "brick_yellow", 144, 112 );
-  sprite_render( "brick_yellow", 144, 104 );
-  
-  /* Get hold of the fonts in our new renderer. */
-  memcpy( &l_outline_font, bee_text_create_fixed_font( outline_font ), sizeof( bee_font_t ) );
-  memcpy( &l_minimal_font, bee_text_create_fixed_font( minimal_font ), sizeof( bee_font_t ) );
+  /* The backdrop has the frame already on it, and scrolls by palette. */
+  if ( m_backdrop )
+  {
+    effect_backdrop_render();
+  }
+  else
+  {
+    effect_gradient_render( m_gradient );
+    _death_decorate();
+  }
   
   /* Put the headings in somewhere sensible. */
+  TRACE_BEGIN( "text" );
   blit::fb.pen( rgba( 255, 255, 255, 255 ) );
-  bee_text_set_font( &l_outline_font );
+  bee_text_set_font( &m_outline_font );
   l_point.x = blit::fb.bounds.w / 2;
   l_point.y = 1;
   bee_text( &l_point, BEE_ALIGN_CENTRE, "NEW HIGH SCORE!" );
@@ -276,7 +307,7 @@ void death_render( void )
   bee_text( &l_point, BEE_ALIGN_CENTRE, "UP/DOWN TO CHANGE" );
   
   /* Now show the initials, in a different font to be distinctive. */
-  bee_text_set_font( &l_minimal_font );
+  bee_text_set_font( &m_minimal_font );
   l_point.y = 40;
   l_point.x = ( blit::fb.bounds.w / 2 ) - 10;
   bee_text( &l_point, BEE_ALIGN_CENTRE, "%c", m_player[0] );
@@ -284,9 +315,10 @@ void death_render( void )
   bee_text( &l_point, BEE_ALIGN_CENTRE, "%c", m_player[1] );
   l_point.x = ( blit::fb.bounds.w / 2 ) + 10;
   bee_text( &l_point, BEE_ALIGN_CENTRE, "%c", m_player[2] );
+  TRACE_END( "text" );
   
   /* Draw a cursor around the currently selected letter. */
-  blit::fb.pen( m_text_colour );
+  blit::fb.pen( effect_text_colour() );
   blit::fb.line( point( ( blit::fb.bounds.w / 2 ) - 14 + ( 10 * m_cursor ), 38 ), 
                  point( ( blit::fb.bounds.w / 2 ) - 6 + ( 10 * m_cursor ), 38 ) );
   blit::fb.line( point( ( blit::fb.bounds.w / 2 ) - 6 + ( 10 * m_cursor ), 38 ), 
@@ -297,11 +329,14 @@ void death_render( void )
                  point( ( blit::fb.bounds.w / 2 ) - 14 + ( 10 * m_cursor ), 38 ) );
   
   /* Lastly, the text inviting the user to press the start button. */
-  blit::fb.pen( m_text_colour );
-  bee_text_set_font( &l_outline_font );
+  TRACE_BEGIN( "text" );
+  blit::fb.pen( effect_text_colour() );
+  bee_text_set_font( &m_outline_font );
   l_point.x = blit::fb.bounds.w / 2;
   l_point.y = 100;
   bee_text( &l_point, BEE_ALIGN_CENTRE, "PRESS 'B' TO SAVE" );
+  TRACE_END( "text" );
+  return true;
 }
 
 
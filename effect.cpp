@@ -0,0 +1,226 @@
+/*
+ * effect.cpp - part of 32Blox, a breakout game for the 32blit built to
+ * explore the API.
+ *
+ * Shared visual effects. Every screen used to run its own copy of the same
+ * flickering text colour and scrolling gradient, each on its own timer; now
+ * there's just the one, driven by the scheduler, and everyone reads from it.
+ *
+ * Please note that this is a first attempt at understanding a somewhat fluid
+ * API on a shiny new bit of kit, so it probably is not full of 'best practice'.
+ * It will hopefully serve as some sort of starting point, however.
+ *
+ * Coyright (C) 2020 Pete Favelle <pete@fsquared.co.uk>
+ *
+ * This software is provided under the MIT License. See LICENSE.txt for details.
+ */
+
+/* System headers. */
+
+
+
+/* Local headers. */
+
+#include "32blit.hpp"
+#include "32blox.hpp"
+
+
+/* Module variables. */
+
+static rgba         m_text_colour;
+static uint16_t     m_gradient_row;
+static uint32_t     m_generation;
+static uint8_t      m_flicker_timer = SCHEDULE_NONE;
+static uint8_t      m_backdrop_first;
+static uint16_t     m_backdrop_rows;
+
+
+/* Module functions. */
+
+/*
+ * _effect_flicker_update - callback for the font flicker and background
+ */
+
+static void _effect_flicker_update( uint8_t p_timer )
+{
+  static uint16_t ls_loopcount = 0;
+
+  /* Update the text colour used for flickeringness. */
+  if ( ( ls_loopcount += 25 ) > 1200 )
+  {
+    ls_loopcount = 0;
+  }
+  m_text_colour = blit::rgba(
+                              ls_loopcount % 255,
+                              ( ls_loopcount % 512 ) / 2,
+                              255 - ( ls_loopcount % 255 ),
+                              255
+                            );
+  m_gradient_row = ( ls_loopcount / 10 ) % 120;
+
+  /* Let anyone watching know that things have moved on. */
+  m_generation++;
+}
+
+
+/* Functions. */
+
+/*
+ * effect_flicker_start - starts the flicker running, if it isn't already.
+ */
+
+void effect_flicker_start( void )
+{
+  if ( m_flicker_timer == SCHEDULE_NONE )
+  {
+    m_flicker_timer = schedule_create( _effect_flicker_update, 20, -1 );
+  }
+  if ( !schedule_running( m_flicker_timer ) )
+  {
+    schedule_start( m_flicker_timer );
+  }
+}
+
+
+/*
+ * effect_flicker_stop - stops the flicker; the colours freeze where they are.
+ */
+
+void effect_flicker_stop( void )
+{
+  schedule_stop( m_flicker_timer );
+}
+
+
+/*
+ * effect_text_colour - returns the current flickering text colour.
+ */
+
+rgba effect_text_colour( void )
+{
+  return m_text_colour;
+}
+
+
+/*
+ * effect_generation - returns a count which goes up every time the effects
+ *                     change; if it hasn't moved, nor has anything on screen.
+ */
+
+uint32_t effect_generation( void )
+{
+  return m_generation;
+}
+
+
+/*
+ * effect_gradient_create - works out the colours of the background gradient
+ *                          used on the menu screens, into the arena.
+ *
+ * Returns the gradient, one colour per screen row, or NULL if there's no room.
+ */
+
+rgba *effect_gradient_create( void )
+{
+  uint16_t l_row;
+  rgba    *l_gradient;
+
+  l_gradient = (rgba *)arena_alloc( sizeof( rgba ) * blit::fb.bounds.h );
+  if ( l_gradient == NULL )
+  {
+    return NULL;
+  }
+
+  for( l_row = 0; l_row < blit::fb.bounds.h; l_row++ )
+  {
+    l_gradient[l_row] = blit::rgba(
+      (int)( 64.0f + 48.0f * ( sin( M_PI * 2 / blit::fb.bounds.h * l_row  ) ) ),
+      0,
+      (int)( 64.0f + 48.0f * ( cos( M_PI * 2 / blit::fb.bounds.h * l_row ) ) ),
+      255
+    );
+  }
+  return l_gradient;
+}
+
+
+/*
+ * effect_gradient_render - fills the screen with a gradient, scrolled by the
+ *                          current flicker offset.
+ *
+ * const rgba * - the gradient, from effect_gradient_create
+ */
+
+void effect_gradient_render( const rgba *p_gradient )
+{
+  uint16_t l_row;
+
+  /* If we didn't get a gradient, plain black will have to do. */
+  if ( p_gradient == NULL )
+  {
+    blit::fb.pen( rgba( 0, 0, 0, 255 ) );
+    blit::fb.clear();
+    return;
+  }
+
+  for( l_row = 0; l_row < blit::fb.bounds.h; l_row++ )
+  {
+    blit::fb.pen( p_gradient[l_row] );
+    blit::fb.line( point( 0, ( l_row + m_gradient_row ) % blit::fb.bounds.h ),
+             point( blit::fb.bounds.w, ( l_row + m_gradient_row ) % blit::fb.bounds.h ) );
+  }
+}
+
+
+/*
+ * effect_backdrop_create - sets up the indexed target with the gradient as
+ *                          its background, giving each row a palette entry
+ *                          of its own so that scrolling is just a rotation.
+ *                          Anything static can then be drawn on top of it.
+ *
+ * const rgba * - the gradient, from effect_gradient_create
+ *
+ * Returns bool, true if the backdrop is ready to use.
+ */
+
+bool effect_backdrop_create( const rgba *p_gradient )
+{
+  uint16_t l_row, l_first;
+
+  if ( ( p_gradient == NULL ) || !indexed_create() )
+  {
+    return false;
+  }
+
+  /* Grab a run of colours, one per row. */
+  m_backdrop_rows = blit::fb.bounds.h;
+  l_first = indexed_reserve( m_backdrop_rows );
+  if ( l_first == INDEXED_FULL )
+  {
+    indexed_release();
+    return false;
+  }
+  m_backdrop_first = l_first;
+
+  for( l_row = 0; l_row < m_backdrop_rows; l_row++ )
+  {
+    indexed_set_colour( m_backdrop_first + l_row, p_gradient[l_row] );
+    indexed_hline( l_row, m_backdrop_first + l_row );
+  }
+  return true;
+}
+
+
+/*
+ * effect_backdrop_render - draws the backdrop, scrolled by the current
+ *                          flicker offset, in a single pass.
+ */
+
+void effect_backdrop_render( void )
+{
+  indexed_rotate( m_backdrop_first, m_backdrop_rows, m_gradient_row );
+  indexed_render();
+}
+
+
+/* End of effect.cpp */
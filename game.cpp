@@ -26,83 +26,260 @@
 #include "32bee.h"
 
 
+/* Constants. */
+
+#define GAME_BENCH_FRAMES   200
+#define GAME_SAVE_INTERVAL  5000               /* How often to save, in ms. */
+#define GAME_REWIND_TICKS   1                  /* Ticks back, per tick held. */
+#define GAME_IMAGE_VERSION  2                  /* Bump when the image changes. */
+#define GAME_IMAGE_BAT      13                 /* Where the bat type is kept. */
+#define GAME_IMAGE_SIZE     ( 25 + MAX_BALLS ) /* Our own part of the image.  */
+
+
 /* Module variables. */
 
-static rgba         m_text_colour;
 static uint32_t     m_hiscore;
 static uint32_t     m_score;
 static uint8_t      m_lives;
 static uint8_t      m_level;
-static float        m_speed;
+static fixed_t      m_speed;
 static bool         m_flash;
 static int8_t       m_balls[MAX_BALLS];
 static bat_t        m_player;
-static blit::timer  m_flicker_timer, m_level_timer;
+static uint8_t      m_level_timer = SCHEDULE_NONE;
+static uint8_t      m_save_timer = SCHEDULE_NONE;
 static bool         m_waited;
+static bee_font_t   m_outline_font;
+static rgba        *m_gradient;
 static struct { 
   const char *name; 
+  uint8_t     sprite;
+  uint8_t     width;
 }                   m_bats[BAT_MAX];
 
 
 /* Module functions. */
 
 /*
- * _game_flicker_timer_update - callback for the font flicker and background
+ * _game_gradient_pen - works out the background colour for a given row,
+ *                      which is a nice dark gradient based on level.
+ */
+
+static rgba _game_gradient_pen( uint16_t p_row )
+{
+  float l_red, l_green, l_blue;
+  
+  l_red = ( m_level * 5 ) % 64;
+  l_green = ( 64 - ( m_level * 4 ) ) % 64;
+  l_blue = 0;
+  return rgba( l_red - ( l_red * p_row / ( blit::fb.bounds.h - 16.0 ) ), 
+               l_green - ( l_green * p_row / ( blit::fb.bounds.h - 16.0 ) ), 
+               l_blue - ( l_blue * p_row / ( blit::fb.bounds.h - 16.0 ) ), 
+               255 );
+}
+
+/*
+ * _game_level_colours - works out the background for the current level, and
+ *                       has the HUD redraw itself from scratch to match.
  */
 
-void _game_flicker_timer_update( blit::timer &p_timer )
+static void _game_level_colours( void )
 {
-  static uint16_t ls_loopcount = 0;
+  uint8_t l_row;
   
-  /* Update the text colour used for flickeringness. */
-  if ( ( ls_loopcount += 25 ) > 1200 ) 
+  if ( m_gradient != NULL )
+  {
+    for ( l_row = 0; l_row < blit::fb.bounds.h - 16; l_row++ )
+    {
+      m_gradient[l_row] = _game_gradient_pen( l_row );
+    }
+  }
+  for ( l_row = 0; l_row < HUD_HEIGHT; l_row++ )
   {
-    ls_loopcount = 0;
+    hud_set_background( l_row, _game_gradient_pen( l_row ) );
   }
-  m_text_colour = blit::rgba( 
-                              ls_loopcount % 255, 
-                              ( ls_loopcount % 512 ) / 2, 
-                              255 - ( ls_loopcount % 255 ),
-                              255
-                            );
+  hud_invalidate();
 }
 
 /*
  * _game_level_timer_update - pauses at the end of the level.
  */
 
-void _game_level_timer_update( blit::timer &p_timer )
+static void _game_level_timer_update( uint8_t p_timer )
 {
   m_waited = true;
-  p_timer.stop();
+}
+
+/*
+ * _game_save_timer_update - every so often, puts the game somewhere it'll
+ *                           survive the power going off.
+ */
+
+static void _game_save_timer_update( uint8_t )
+{
+  snapshot_save();
+}
+
+/*
+ * _game_set_bat - switches the player to a different type of bat, keeping
+ *                 it within the screen if it's grown.
+ */
+
+static void _game_set_bat( battype_t p_type )
+{
+  m_player.type = p_type;
+  m_player.width = m_bats[p_type].width;
+  if ( m_player.position < FIXED_FROM_INT( m_player.width / 2 ) )
+  {
+    m_player.position = FIXED_FROM_INT( m_player.width / 2 );
+  }
+  if ( m_player.position > FIXED_FROM_INT( blit::fb.bounds.w - ( m_player.width / 2 ) ) )
+  {
+    m_player.position = FIXED_FROM_INT( blit::fb.bounds.w - ( m_player.width / 2 ) );
+  }
+}
+
+/*
+ * _game_multiball - splits every ball in flight in two, as far as there are
+ *                   free slots to do so.
+ */
+
+static void _game_multiball( void )
+{
+  uint8_t l_index, l_slot, l_ball;
+  int8_t  l_balls[MAX_BALLS];
+
+  /* Work from a copy, so we don't split the balls we've just split off. */
+  memcpy( l_balls, m_balls, MAX_BALLS );
+  for ( l_index = 0; l_index < MAX_BALLS; l_index++ )
+  {
+    if ( l_balls[l_index] < 0 )
+    {
+      continue;
+    }
+    for ( l_slot = 0; l_slot < MAX_BALLS; l_slot++ )
+    {
+      if ( m_balls[l_slot] < 0 )
+      {
+        break;
+      }
+    }
+    if ( l_slot == MAX_BALLS )
+    {
+      return;
+    }
+    l_ball = ball_spawn( l_balls[l_index] );
+    if ( l_ball < MAX_BALLS )
+    {
+      m_balls[l_slot] = l_ball;
+    }
+  }
+}
+
+/*
+ * _game_render_bat - draws the player's bat, centred on its position.
+ */
+
+static void _game_render_bat( void )
+{
+  sprite_render_id( m_bats[m_player.type].sprite, FIXED_INT( m_player.position ),
+                    m_player.baseline, ALIGN_TOPCENTRE );
+}
+
+/*
+ * _game_lowest_bit - finds the lowest bit set in a (non-zero) mask.
+ *
+ * uint32_t - the mask to look in
+ *
+ * Returns the index of the lowest set bit.
+ */
+
+static uint8_t _game_lowest_bit( uint32_t p_mask )
+{
+#ifdef __GNUC__
+  return __builtin_ctz( p_mask );
+#else
+  uint8_t l_bit = 0;
+
+  while ( ( p_mask & 1 ) == 0 )
+  {
+    p_mask >>= 1;
+    l_bit++;
+  }
+  return l_bit;
+#endif
+}
+
+/*
+ * _game_render_bricks - draws the bricks still standing. We only visit the
+ *                       rows, and then the columns, which the level says
+ *                       have anything in, so the less that's left the less
+ *                       it costs; full sized bricks get their sprites, and
+ *                       squeezed ones a plain block.
+ */
+
+static void _game_render_bricks( void )
+{
+  uint32_t            l_rows, l_columns;
+  uint8_t             l_row, l_column;
+  uint8_t            *l_line;
+  const bricktype_t  *l_type;
+  bool                l_sprites = board_full_size();
+  TRACE_SCOPE( "bricks" );
+
+  for ( l_rows = level_get_rows(); l_rows != 0; l_rows &= l_rows - 1 )
+  {
+    l_row = _game_lowest_bit( l_rows );
+    l_line = level_get_line( l_row );
+    for ( l_columns = level_get_row_mask( l_row ); l_columns != 0; l_columns &= l_columns - 1 )
+    {
+      l_column = _game_lowest_bit( l_columns );
+      l_type = level_get_bricktype( l_line[l_column] );
+      if ( l_sprites )
+      {
+        sprite_render_id( l_type->sprite, board_left( l_column ), board_top( l_row ) );
+      }
+      else
+      {
+        blit::fb.pen( l_type->debris );
+        blit::fb.rectangle( board_brick( l_row, l_column ) );
+      }
+    }
+  }
 }
 
 
 /* Functions. */
 
 /*
- * game_init - called at the start of a new game, to blank scores and
- *             configure suitable levels.
+ * game_enter - called at the start of a new game, to blank scores and
+ *              configure suitable levels.
  */
 
-void game_init( void )
+void game_enter( void )
 {
-  /* Initialise the bat details. */
+  /* Initialise the bat details, each from its own sprite. */
   m_bats[BAT_NORMAL].name = "bat_normal";
+  m_bats[BAT_NORMAL].sprite = sprite_id( m_bats[BAT_NORMAL].name );
+  m_bats[BAT_NORMAL].width = sprite_size( m_bats[BAT_NORMAL].name ).w;
+  m_bats[BAT_WIDE].name = "bat_wide";
+  m_bats[BAT_WIDE].sprite = sprite_id( m_bats[BAT_WIDE].name );
+  m_bats[BAT_WIDE].width = sprite_size( m_bats[BAT_WIDE].name ).w;
   
   /* Set the player stats to an opening value. */
   m_score = 0;
   m_lives = 3;
   m_level = 1;
-  m_speed = 1.1f;
+  m_speed = FIXED( 1.1f );
   m_flash = false;
   
   m_player.type = BAT_NORMAL;
-  m_player.position = blit::fb.bounds.w / 2;
+  m_player.position = FIXED_FROM_INT( blit::fb.bounds.w / 2 );
   m_player.baseline = blit::fb.bounds.h - 8;
-  m_player.width = sprite_size( m_bats[BAT_NORMAL].name ).w;
+  m_player.width = m_bats[BAT_NORMAL].width;
   
-  m_level_timer.init( _game_level_timer_update, 1500, 0 );
+  m_level_timer = schedule_create( _game_level_timer_update, 1500, 1 );
+  m_save_timer = schedule_create( _game_save_timer_update, GAME_SAVE_INTERVAL, -1 );
   m_waited = false;
   
   /* Initialise that level. */
@@ -111,9 +288,54 @@ void game_init( void )
   /* Fetch the current high score from long term storage. */
   m_hiscore = hiscore_get_score( 0 );
   
-  /* Spawn a ball on the player's bat. */
+  /* And the HUD will need drawing from scratch. */
+  m_gradient = (rgba *)arena_alloc( sizeof( rgba ) * ( blit::fb.bounds.h - 16 ) );
+  hud_init();
+  _game_level_colours();
+  
+  /* Get hold of the outline font in our new renderer. */
+  memcpy( &m_outline_font, bee_text_create_fixed_font( outline_font ), sizeof( bee_font_t ) );
+  
+  /* Games the computer plays must play out the same way every time. */
+  random_seed( autoplay_active() ? autoplay_seed() : blit::now() );
+
+  /* Spawn a ball on the player's bat; the grid is how balls find each other. */
+  grid_create( MAX_BALLS );
+  ball_reset();
   memset( m_balls, -1, MAX_BALLS );
   m_balls[0] = ball_create( m_player );
+  
+  /* Start watching for bricks to shed debris and power ups from. */
+  particle_init();
+  powerup_init();
+  
+  /* And start things flickering. */
+  effect_flicker_start();
+  
+  /* If a game was cut short, pick it up where it was left; either way, */
+  /* the history starts here, and we keep saving as we go. The computer */
+  /* neither picks up a player's game, nor leaves one of its own.       */
+  snapshot_reset();
+  if ( !autoplay_active() )
+  {
+    snapshot_load();
+    schedule_start( m_save_timer );
+  }
+}
+
+
+/*
+ * game_exit - called when the game is over, to tidy up.
+ */
+
+void game_exit( void )
+{
+  schedule_stop( m_level_timer );
+  schedule_stop( m_save_timer );
+  effect_flicker_stop();
+  particle_exit();
+  powerup_exit();
+  m_gradient = NULL;
 }
 
 /*
@@ -126,37 +348,40 @@ void game_init( void )
 gamestate_t game_update( void )
 {
   int8_t  l_score;
-  uint8_t l_index;
+  uint8_t l_index, l_caught, l_auto;
+  TRACE_SCOPE( "game_update" );
   
-  /* If it's not running, we need to set up the flicker timer. */
-  if ( !m_flicker_timer.is_running() )
+  /* While Y is held, time runs backwards instead. */
+  if ( ( blit::pressed( blit::button::Y ) ) && ( snapshot_rewind( GAME_REWIND_TICKS ) ) )
   {
-    m_flicker_timer.init( _game_flicker_timer_update, 20, -1 );
-    m_flicker_timer.start();
+    return STATE_GAME;
   }
-    
+  
+  /* If the computer is playing, it gets a say in what's pressed. */
+  l_auto = autoplay_active() ? autoplay_update( m_player, m_balls ) : 0;
+  
   /* See if the player is moving left. */
-  if ( ( blit::pressed( blit::button::DPAD_LEFT ) ) || ( blit::joystick.x < -0.1f ) )
+  if ( ( l_auto & AUTOPLAY_LEFT ) || ( blit::pressed( blit::button::DPAD_LEFT ) ) || ( blit::joystick.x < -0.1f ) )
   {
     /* Don't let them go outside of bounds. */
-    if ( ( m_player.position -= m_speed ) < ( m_player.width / 2 ) )
+    if ( ( m_player.position -= m_speed ) < FIXED_FROM_INT( m_player.width / 2 ) )
     {
       m_player.position += m_speed;
     }
   }
   
   /* Or right, come to that! */
-  if ( ( blit::pressed( blit::button::DPAD_RIGHT ) ) || ( blit::joystick.x > 0.1f ) )
+  if ( ( l_auto & AUTOPLAY_RIGHT ) || ( blit::pressed( blit::button::DPAD_RIGHT ) ) || ( blit::joystick.x > 0.1f ) )
   {
     /* Don't let them go outside of bounds. */
-    if ( ( m_player.position += m_speed ) > ( blit::fb.bounds.w - ( m_player.width / 2 ) ) )
+    if ( ( m_player.position += m_speed ) > FIXED_FROM_INT( blit::fb.bounds.w - ( m_player.width / 2 ) ) )
     {
       m_player.position -= m_speed;
     }
   }
   
   /* If they press the B button, launch any balls we're currently holding. */
-  if ( ( blit::pressed( blit::button::B ) ) && ( level_get_bricks() > 0 ) )
+  if ( ( ( l_auto & AUTOPLAY_LAUNCH ) || ( blit::pressed( blit::button::B ) ) ) && ( level_get_bricks() > 0 ) )
   {
     for ( l_index = 0; l_index < MAX_BALLS; l_index++ )
     {
@@ -188,6 +413,30 @@ gamestate_t game_update( void )
     }
   }
   
+  /* That's every ball moved on for this tick. */
+  ball_end_tick();
+  
+  /* Multiball means balls can bump into each other, too. */
+  ball_collide_all();
+  
+  /* Any bricks hit will have thrown off some debris. */
+  particle_update();
+  
+  /* And maybe a power up or two, which the player might have caught. */
+  l_caught = powerup_update( m_player );
+  if ( l_caught & ( 1 << POWERUP_MULTIBALL ) )
+  {
+    _game_multiball();
+  }
+  if ( l_caught & ( 1 << POWERUP_WIDE ) )
+  {
+    _game_set_bat( BAT_WIDE );
+  }
+  if ( l_caught & ( 1 << POWERUP_SLOW ) )
+  {
+    ball_slow( POWERUP_SLOW_TICKS );
+  }
+  
   /* If no balls are left in play, a life it lost. If there are more lives, */
   /* then a fresh ball is spawned. If not, it's game over (man).            */
   for ( l_index = 0; l_index < MAX_BALLS; l_index++ )
@@ -201,13 +450,21 @@ gamestate_t game_update( void )
   {
     if ( --m_lives <=0 )
     {
-      m_flicker_timer.stop();
+      /* The computer's scores don't go in the table, and it's got no */
+      /* saved game to throw away; a player's might be in there.      */
+      if ( autoplay_active() )
+      {
+        autoplay_end_game( m_score, m_level );
+        return STATE_SPLASH;
+      }
+      snapshot_discard();
       if ( death_check_score( m_score ) )
       {
         return STATE_DEATH;
       }
       return STATE_HISCORE;
     }
+    _game_set_bat( BAT_NORMAL );
     m_balls[0] = ball_create( m_player );
   }
   
@@ -216,10 +473,11 @@ gamestate_t game_update( void )
   {
     printf( "end of level - waiting is %d\n", m_waited );
     /* If the timer isn't running, then start it. */
-    if ( !m_waited && !m_level_timer.is_running() )
+    if ( !m_waited && !schedule_running( m_level_timer ) )
     {
       printf( "start timer\n" );
-      m_level_timer.start();
+      schedule_start( m_level_timer );
+      ball_reset();
       memset( m_balls, -1, MAX_BALLS );
       m_balls[0] = ball_create( m_player );
     }
@@ -228,25 +486,139 @@ gamestate_t game_update( void )
       printf( "start new level\n" );
       /* If we've shown "you're a winner!" long enough, jump to the next level. */
       level_init( ++m_level );
+      _game_level_colours();
+      _game_set_bat( BAT_NORMAL );
     }
   }
   
+  /* Remember how things stand, in case we want to come back here. */
+  snapshot_record();
+  
   /* Default to the status quo, then. */
   return STATE_GAME;
 }
 
 
+/*
+ * game_save - writes the state of play into a snapshot image; ours first,
+ *             with where the random numbers are up to, then the board, the
+ *             balls and the power ups. Everything is written field by field
+ *             at a fixed size and byte order, so the image doesn't depend on
+ *             how the compiler lays out a struct.
+ *
+ * uint8_t * - where to write it, at least SNAPSHOT_IMAGE_SIZE bytes
+ *
+ * Returns the number of bytes written.
+ */
+
+uint16_t game_save( uint8_t *p_image )
+{
+  uint16_t l_length = 0;
+  uint8_t  l_index;
+
+  p_image[l_length++] = GAME_IMAGE_VERSION;
+  l_length += snapshot_put_32( &p_image[l_length], m_score );
+  p_image[l_length++] = m_lives;
+  p_image[l_length++] = m_level;
+  p_image[l_length++] = m_waited;
+  p_image[l_length++] = schedule_running( m_level_timer );
+  l_length += snapshot_put_32( &p_image[l_length], schedule_time_left( m_level_timer ) );
+  p_image[l_length++] = m_player.type;
+  l_length += snapshot_put_32( &p_image[l_length], m_player.position );
+  l_length += snapshot_put_16( &p_image[l_length], m_player.baseline );
+  p_image[l_length++] = m_player.width;
+  for ( l_index = 0; l_index < MAX_BALLS; l_index++ )
+  {
+    p_image[l_length++] = m_balls[l_index];
+  }
+  l_length += random_save( &p_image[l_length] );
+
+  l_length += level_save( &p_image[l_length] );
+  l_length += ball_save( &p_image[l_length] );
+  l_length += powerup_save( &p_image[l_length] );
+  return l_length;
+}
+
+
+/*
+ * game_restore - puts the state of play back the way game_save found it.
+ *
+ * const uint8_t * - the image to read from
+ * uint16_t        - the size of it
+ *
+ * Returns bool, true if the image was good and has been restored.
+ */
+
+bool game_restore( const uint8_t *p_image, uint16_t p_length )
+{
+  uint16_t l_length = 0;
+  uint8_t  l_level, l_index;
+  bool     l_timer;
+  uint32_t l_time_left;
+
+  /* Check what we can before touching anything. */
+  if ( ( p_length < GAME_IMAGE_SIZE + 2 ) || ( p_image[0] != GAME_IMAGE_VERSION ) ||
+       ( p_image[GAME_IMAGE_BAT] >= BAT_MAX ) ||
+       ( p_image[GAME_IMAGE_SIZE] > BOARD_MAX_COLUMNS ) || ( p_image[GAME_IMAGE_SIZE + 1] > BOARD_MAX_ROWS ) )
+  {
+    return false;
+  }
+
+  l_length = 1;
+  m_score = snapshot_get_32( &p_image[l_length] );
+  l_length += 4;
+  m_lives = p_image[l_length++];
+  l_level = p_image[l_length++];
+  m_waited = p_image[l_length++];
+  l_timer = p_image[l_length++];
+  l_time_left = snapshot_get_32( &p_image[l_length] );
+  l_length += 4;
+  m_player.type = (battype_t)p_image[l_length++];
+  m_player.position = snapshot_get_32( &p_image[l_length] );
+  l_length += 4;
+  m_player.baseline = snapshot_get_16( &p_image[l_length] );
+  l_length += 2;
+  m_player.width = p_image[l_length++];
+  for ( l_index = 0; l_index < MAX_BALLS; l_index++ )
+  {
+    m_balls[l_index] = p_image[l_length++];
+  }
+  l_length += random_restore( &p_image[l_length] );
+
+  /* The level timer picks up with however long it had left. */
+  if ( l_timer )
+  {
+    schedule_start_after( m_level_timer, l_time_left );
+  }
+  else
+  {
+    schedule_stop( m_level_timer );
+  }
+
+  l_length += level_restore( &p_image[l_length] );
+  l_length += ball_restore( &p_image[l_length] );
+  l_length += powerup_restore( &p_image[l_length] );
+
+  /* A different level means a different background. */
+  if ( l_level != m_level )
+  {
+    m_level = l_level;
+    _game_level_colours();
+  }
+  return ( l_length == p_length );
+}
+
+
 /* 
  * game_render - draw the current splash screen state onto the screen.
+ *
+ * Returns bool, true if anything was drawn; which is always, in the game.
  */
 
-void game_render( void )
+bool game_render( void )
 {
-  uint8_t       l_index, l_brick;
-  float         l_red, l_green, l_blue;
-  uint8_t      *l_line;
+  uint8_t       l_index;
   bee_point_t   l_point;
-  bee_font_t    l_outline_font, l_minimal_font;
   
   /* Clear the screen back to something sensible. */
   if ( m_flash )
@@ -256,71 +628,34 @@ void game_render( void )
   }
   else
   {
-    /* Basically black. */
+    /* Basically black; but the HUD only redraws what has changed, so */
+    /* its rows have to be left well alone.                           */
     blit::fb.pen( rgba( 0, 0, 0, 255 ) );
-    blit::fb.clear();
+    blit::fb.rectangle( rect( 0, HUD_HEIGHT, blit::fb.bounds.w, blit::fb.bounds.h - HUD_HEIGHT ) );
     
-    /* But let's put a nice dark gradient in there, based on level. */
-    l_red = ( m_level * 5 ) % 64;
-    l_green = ( 64 - ( m_level * 4 ) ) % 64;
-    l_blue = 0;
-    for( l_index = 0; l_index < blit::fb.bounds.h - 16; l_index++ )
+    /* And then put a nice dark gradient in there, based on level. */
+    for( l_index = HUD_HEIGHT; ( m_gradient != NULL ) && ( l_index < blit::fb.bounds.h - 16 ); l_index++ )
     {
-      blit::fb.pen( rgba( l_red - ( l_red * l_index / ( blit::fb.bounds.h - 16.0 ) ), 
-                    l_green - ( l_green * l_index / ( blit::fb.bounds.h - 16.0 ) ), 
-                    l_blue - ( l_blue * l_index / ( blit::fb.bounds.h - 16.0 ) ), 
-                    255 ) );
+      blit::fb.pen( m_gradient[l_index] );
       blit::fb.line( point( 0, l_index ), point( blit::fb.bounds.w, l_index ) );
     }
   }
   
-  /* Get hold of the fonts in our new renderer. */
-  memcpy( &l_outline_font, bee_text_create_fixed_font( outline_font ), sizeof( bee_font_t ) );
-  memcpy( &l_minimal_font, bee_text_create_fixed_font( minimal_font ), sizeof( bee_font_t ) );
-  
-  /* Render the top status line. */
-#pragma GCC diagnostic ignored "-Wformat"
-  blit::fb.pen( rgba( 255, 255, 255, 255 ) );
-  bee_text_set_font( &l_minimal_font );
-  l_point.x = l_point.y = 1;
-  bee_text( &l_point, BEE_ALIGN_NONE, "HI:%05lu", m_hiscore );
-  l_point.x = blit::fb.bounds.w - 2;
-  bee_text( &l_point, BEE_ALIGN_RIGHT, "SC:%05lu", m_score );
-#pragma GCC diagnostic pop
-  
-  /* Lives are tricky, we can run out of space... */
-  if ( m_lives < 5 )
-  {
-    for ( l_index = 0; l_index < ( m_lives - 1 ); l_index++ )
-    {
-      sprite_render( "bat_normal", 72 - ( ( m_lives - 2 ) * 10 ) + ( l_index * 20 ), 3 );
-    }
-  }
+  /* Render the top status line; the HUD only redraws what has changed. */
+  hud_set_hiscore( m_hiscore );
+  hud_set_score( m_score );
+  hud_set_lives( m_lives );
+  hud_render();
   
   /* Underline that, to form a hard border to bounce off at the top. */
   blit::fb.pen( rgba( 255, 255, 255, 255 ) );
   blit::fb.line( point( 0, 9 ), point( blit::fb.bounds.w, 9 ) );
   
   /* Now we draw up the surviving bricks in the level. */
-  for ( l_index = 0; l_index < 10; l_index++ )
-  {
-    /* Fetch the current state, a line at a time. */
-    l_line = level_get_line( l_index );
-    
-    /* And work through a brick at a time. */
-    for ( l_brick = 0; l_brick < 10; l_brick++ )
-    {
-      /* Only try and draw bricks which are actually there... */
-      if ( l_line[ l_brick ] > 0 )
-      {
-        sprite_render( level_get_bricktype( l_line[ l_brick ] ),
-                       l_brick * 16, 10 + ( l_index * 8 ) );
-      }
-    }
-  }
+  _game_render_bricks();
   
   /* Add in the current bat. */
-  sprite_render( m_bats[m_player.type].name, m_player.position, m_player.baseline, ALIGN_TOPCENTRE );
+  _game_render_bat();
   
   /* And the ball(s), obviously. */
   for ( l_index = 0; l_index < MAX_BALLS; l_index++ )
@@ -331,31 +666,108 @@ void game_render( void )
       ball_render( m_balls[l_index] );
       if ( ( ball_stuck( m_balls[l_index] ) ) && ( level_get_bricks() > 0 ) )
       {
-        blit::fb.pen( m_text_colour );
-        bee_text_set_font( &l_outline_font );
+        TRACE_BEGIN( "text" );
+        blit::fb.pen( effect_text_colour() );
+        bee_text_set_font( &m_outline_font );
         l_point.x = blit::fb.bounds.w / 2;
         l_point.y = 82;
         bee_text( &l_point, BEE_ALIGN_CENTRE, "LEVEL %02d", m_level );
         l_point.y = 90;
         bee_text( &l_point, BEE_ALIGN_CENTRE, "PRESS 'B' TO LAUNCH" );
+        TRACE_END( "text" );
       }
     }
   }
   
   /* Any falling debris, specials or effects. */
+  particle_render();
+  powerup_render();
   
   /* And if the level is completed, let them know! */
   if ( level_get_bricks() == 0 )
   {
-    blit::fb.pen( m_text_colour );
-    bee_text_set_font( &l_outline_font );
+    TRACE_BEGIN( "text" );
+    blit::fb.pen( effect_text_colour() );
+    bee_text_set_font( &m_outline_font );
     l_point.x = blit::fb.bounds.w / 2;
     l_point.y = 46;
     bee_text( &l_point, BEE_ALIGN_CENTRE, "LEVEL %02d CLEARED", m_level );
     l_point.y = 60;
     bee_text( &l_point, BEE_ALIGN_CENTRE, "GET READY!" );
+    TRACE_END( "text" );
+  }
+  
+  return true;
+}
+
+
+#ifdef BLOX_BENCH
+
+/*
+ * game_bench - times the board's share of a frame (drawing the bricks, and
+ *              a ball working its way through them) on boards of different
+ *              sizes, and again once most of the bricks are gone.
+ */
+
+void game_bench( void )
+{
+  static uint8_t  ls_bricks[BOARD_MAX_ROWS * BOARD_MAX_COLUMNS];
+  const uint8_t   l_sizes[] = { 10, 20, 32 };
+  uint8_t         l_run, l_pass, l_ball;
+  uint16_t        l_frame, l_index;
+  uint32_t        l_start, l_elapsed;
+  bat_t           l_bat;
+
+  l_bat.type = BAT_NORMAL;
+  l_bat.position = FIXED_FROM_INT( blit::fb.bounds.w / 2 );
+  l_bat.baseline = blit::fb.bounds.h - 8;
+  l_bat.width = sprite_size( "bat_normal" ).w;
+
+  for ( l_run = 0; l_run < sizeof( l_sizes ) / sizeof( l_sizes[0] ); l_run++ )
+  {
+    /* A full board of the size in question, first of all. */
+    for ( l_index = 0; l_index < l_sizes[l_run] * l_sizes[l_run]; l_index++ )
+    {
+      ls_bricks[l_index] = 1 + ( l_index % 3 );
+    }
+    level_init( 0 );
+    level_load( l_sizes[l_run], l_sizes[l_run], ls_bricks );
+
+    for ( l_pass = 0; l_pass < 2; l_pass++ )
+    {
+      /* The second time around, knock out nine bricks in every ten. */
+      if ( l_pass == 1 )
+      {
+        for ( l_index = 0; l_index < l_sizes[l_run] * l_sizes[l_run]; l_index++ )
+        {
+          ls_bricks[l_index] = ( l_index % 10 ) ? 0 : ls_bricks[l_index];
+        }
+        level_load( l_sizes[l_run], l_sizes[l_run], ls_bricks );
+      }
+
+      ball_reset();
+      l_ball = ball_create( l_bat );
+      ball_launch( l_ball );
+      l_start = blit::now();
+      for ( l_frame = 0; l_frame < GAME_BENCH_FRAMES; l_frame++ )
+      {
+        _game_render_bricks();
+        if ( ball_update( l_ball, l_bat ) < 0 )
+        {
+          l_ball = ball_create( l_bat );
+          ball_launch( l_ball );
+        }
+      }
+      l_elapsed = blit::now() - l_start;
+
+      printf( "bench: %2ux%-2u board, %4u bricks, %6lu us/frame\n", l_sizes[l_run], l_sizes[l_run],
+              level_get_bricks(), (unsigned long)( ( l_elapsed * 1000 ) / GAME_BENCH_FRAMES ) );
+    }
   }
+  ball_reset();
 }
 
+#endif /* BLOX_BENCH */
+
 
 /* End of game.cpp */
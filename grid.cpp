@@ -0,0 +1,192 @@
+/*
+ * grid.cpp - part of 32Blox, a breakout game for the 32blit built to
+ * explore the API.
+ *
+ * A uniform grid over the screen, for finding things which are near each
+ * other without checking everything against everything else. Items are
+ * just numbers; each cell holds a linked list of them, threaded through a
+ * 'next' array, so rebuilding the whole thing every tick is a single pass
+ * with no allocation at all.
+ *
+ * The storage lives in the arena, so create the grid on entering a state.
+ *
+ * Please note that this is a first attempt at understanding a somewhat fluid
+ * API on a shiny new bit of kit, so it probably is not full of 'best practice'.
+ * It will hopefully serve as some sort of starting point, however.
+ *
+ * Coyright (C) 2020 Pete Favelle <pete@fsquared.co.uk>
+ *
+ * This software is provided under the MIT License. See LICENSE.txt for details.
+ */
+
+/* System headers. */
+
+#include <string.h>
+
+
+/* Local headers. */
+
+#include "32blit.hpp"
+#include "32blox.hpp"
+
+
+/* Module variables. */
+
+static uint16_t    *m_heads;              /* First item in each cell.        */
+static uint16_t    *m_next;               /* Next item in the same cell.     */
+static uint16_t     m_items;
+static uint8_t      m_columns, m_rows;
+
+
+/* Functions. */
+
+/*
+ * grid_create - sets up a grid covering the screen, in the arena.
+ *
+ * uint16_t - the most items that will ever be in the grid at once
+ *
+ * Returns bool, true if there was room for it.
+ */
+
+bool grid_create( uint16_t p_items )
+{
+  m_columns = ( blit::fb.bounds.w + GRID_CELL - 1 ) / GRID_CELL;
+  m_rows = ( blit::fb.bounds.h + GRID_CELL - 1 ) / GRID_CELL;
+  m_heads = (uint16_t *)arena_alloc( sizeof( uint16_t ) * m_columns * m_rows );
+  m_next = (uint16_t *)arena_alloc( sizeof( uint16_t ) * p_items );
+  if ( ( m_heads == NULL ) || ( m_next == NULL ) )
+  {
+    m_heads = m_next = NULL;
+    m_items = 0;
+    return false;
+  }
+
+  m_items = p_items;
+  grid_clear();
+  return true;
+}
+
+
+/*
+ * grid_clear - empties every cell, ready for a fresh set of items.
+ */
+
+void grid_clear( void )
+{
+  if ( m_heads != NULL )
+  {
+    memset( m_heads, 0xff, sizeof( uint16_t ) * m_columns * m_rows );
+  }
+}
+
+
+/*
+ * grid_cell - works out which cell a point falls in.
+ *
+ * int16_t - the column (x) of the point
+ * int16_t - the row (y) of the point
+ *
+ * Returns the cell index, or GRID_NONE if it's off the grid.
+ */
+
+uint16_t grid_cell( int16_t p_column, int16_t p_row )
+{
+  if ( ( m_heads == NULL ) || ( p_column < 0 ) || ( p_row < 0 ) )
+  {
+    return GRID_NONE;
+  }
+
+  p_column /= GRID_CELL;
+  p_row /= GRID_CELL;
+  if ( ( p_column >= m_columns ) || ( p_row >= m_rows ) )
+  {
+    return GRID_NONE;
+  }
+  return ( p_row * m_columns ) + p_column;
+}
+
+
+/*
+ * grid_insert - drops an item into the cell at the given point; anything off
+ *               the grid is quietly ignored.
+ *
+ * uint16_t - the item
+ * int16_t  - the column (x) of the item
+ * int16_t  - the row (y) of the item
+ */
+
+void grid_insert( uint16_t p_item, int16_t p_column, int16_t p_row )
+{
+  uint16_t l_cell = grid_cell( p_column, p_row );
+
+  if ( ( l_cell == GRID_NONE ) || ( p_item >= m_items ) )
+  {
+    return;
+  }
+  m_next[p_item] = m_heads[l_cell];
+  m_heads[l_cell] = p_item;
+}
+
+
+/*
+ * grid_first - returns the first item in a cell.
+ *
+ * uint16_t - the cell index, from grid_cell
+ *
+ * Returns the item, or GRID_NONE if the cell is empty.
+ */
+
+uint16_t grid_first( uint16_t p_cell )
+{
+  if ( ( m_heads == NULL ) || ( p_cell >= m_columns * m_rows ) )
+  {
+    return GRID_NONE;
+  }
+  return m_heads[p_cell];
+}
+
+
+/*
+ * grid_next - returns the item after this one, in the same cell.
+ *
+ * uint16_t - the current item
+ *
+ * Returns the next item, or GRID_NONE at the end of the cell.
+ */
+
+uint16_t grid_next( uint16_t p_item )
+{
+  return ( p_item < m_items ) ? m_next[p_item] : GRID_NONE;
+}
+
+
+/*
+ * grid_neighbour - finds the cell next to another one.
+ *
+ * uint16_t - the cell index
+ * int8_t   - how many cells across to move
+ * int8_t   - how many cells down to move
+ *
+ * Returns the neighbouring cell index, or GRID_NONE if that's off the grid.
+ */
+
+uint16_t grid_neighbour( uint16_t p_cell, int8_t p_across, int8_t p_down )
+{
+  int16_t l_column, l_row;
+
+  if ( ( m_heads == NULL ) || ( p_cell >= m_columns * m_rows ) )
+  {
+    return GRID_NONE;
+  }
+
+  l_column = ( p_cell % m_columns ) + p_across;
+  l_row = ( p_cell / m_columns ) + p_down;
+  if ( ( l_column < 0 ) || ( l_row < 0 ) || ( l_column >= m_columns ) || ( l_row >= m_rows ) )
+  {
+    return GRID_NONE;
+  }
+  return ( l_row * m_columns ) + l_column;
+}
+
+
+/* End of grid.cpp */
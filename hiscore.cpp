@@ -8,6 +8,11 @@
  * Yes, in a proper, object-y world this would be two different objects, or
  * something. This is a litle console game, so cut me some slack.
  *
+ * The table is stored as a small versioned record with a CRC on the end. We
+ * keep two copies and alternate between them, so a write that gets cut off
+ * half way through still leaves the previous table intact. Writes are held
+ * back until things are quiet, rather than happening as the score is saved.
+ *
  * Please note that this is a first attempt at understanding a somewhat fluid
  * API on a shiny new bit of kit, so it probably is not full of 'best practice'.
  * It will hopefully serve as some sort of starting point, however.
@@ -29,39 +34,150 @@
 
 #include "32bee.h"
 
+
+/* Constants. */
+
+#define HISCORE_MAGIC         "BLOX"
+#define HISCORE_VERSION       1
+#define HISCORE_ENTRY_SIZE    7
+#define HISCORE_RECORD_SIZE   ( 8 + ( HISCORE_ENTRY_SIZE * MAX_SCORES ) + 4 )
+#define HISCORE_FLUSH_DELAY   500
+#define HISCORE_LOAD_BUDGET   50
+
+
 /* Module variables. */
 
-static rgba         m_text_colour;
-static uint16_t     m_gradient_row;
-static blit::timer  m_flicker_timer;
 static struct { 
   uint32_t score; 
   char name[3]; 
 }                   m_scores[MAX_SCORES];
+static bee_font_t   m_outline_font;
+static rgba        *m_gradient;
+static bool         m_backdrop;
+static uint32_t     m_generation;
+static bool         m_redraw;
+static uint16_t     m_sequence;
+static bool         m_dirty;
+static uint8_t      m_flush_timer = SCHEDULE_NONE;
 
 
 /* Module functions. */
 
 /*
- * _hiscore_flicker_timer_update - callback for the font flicker and background
+ * _hiscore_load_slot - reads and validates one of the stored copies.
+ *
+ * Returns bool, true if the slot held a good record; the sequence number
+ * and scores are only touched if so, and if it's newer than what we have.
  */
 
-void _hiscore_flicker_timer_update( blit::timer &p_timer )
+static bool _hiscore_load_slot( uint8_t p_slot, bool p_have_one )
 {
-  static uint16_t ls_loopcount = 0;
+  uint8_t  l_record[HISCORE_RECORD_SIZE];
+  uint8_t *l_entry;
+  uint16_t l_sequence;
+  uint32_t l_crc;
+  uint8_t  l_index;
+  
+  /* Fetch it, and check that it looks like one of ours. */
+  if ( !storage_read( p_slot * HISCORE_RECORD_SIZE, l_record, HISCORE_RECORD_SIZE ) )
+  {
+    return false;
+  }
+  if ( ( memcmp( l_record, HISCORE_MAGIC, 4 ) != 0 ) || 
+       ( l_record[4] != HISCORE_VERSION ) || ( l_record[5] != MAX_SCORES ) )
+  {
+    return false;
+  }
+  l_crc = l_record[HISCORE_RECORD_SIZE-4] | ( l_record[HISCORE_RECORD_SIZE-3] << 8 ) |
+          ( l_record[HISCORE_RECORD_SIZE-2] << 16 ) | ( (uint32_t)l_record[HISCORE_RECORD_SIZE-1] << 24 );
+  if ( l_crc != storage_crc( l_record, HISCORE_RECORD_SIZE - 4 ) )
+  {
+    return false;
+  }
+  
+  /* Only take it if it's newer than the other slot. */
+  l_sequence = l_record[6] | ( l_record[7] << 8 );
+  if ( ( p_have_one ) && ( (int16_t)( l_sequence - m_sequence ) <= 0 ) )
+  {
+    return true;
+  }
+  m_sequence = l_sequence;
   
-  /* Update the text colour used for flickeringness. */
-  if ( ( ls_loopcount += 25 ) > 1200 ) 
+  l_entry = &l_record[8];
+  for ( l_index = 0; l_index < MAX_SCORES; l_index++ )
   {
-    ls_loopcount = 0;
+    m_scores[l_index].score = l_entry[0] | ( l_entry[1] << 8 ) | 
+                              ( l_entry[2] << 16 ) | ( (uint32_t)l_entry[3] << 24 );
+    m_scores[l_index].name[0] = l_entry[4];
+    m_scores[l_index].name[1] = l_entry[5];
+    m_scores[l_index].name[2] = l_entry[6];
+    l_entry += HISCORE_ENTRY_SIZE;
   }
-  m_text_colour = blit::rgba( 
-                              ls_loopcount % 255, 
-                              ( ls_loopcount % 512 ) / 2, 
-                              255 - ( ls_loopcount % 255 ),
-                              255
-                            );
-  m_gradient_row = ( ls_loopcount / 10 ) % 120;
+  return true;
+}
+
+
+/*
+ * _hiscore_flush - writes the table out to long term storage, into whichever
+ *                  slot doesn't hold the current copy.
+ */
+
+static void _hiscore_flush( void )
+{
+  uint8_t  l_record[HISCORE_RECORD_SIZE];
+  uint8_t *l_entry;
+  uint32_t l_crc;
+  uint8_t  l_index;
+  
+  /* Nothing to do if nothing's changed. */
+  if ( !m_dirty )
+  {
+    return;
+  }
+  m_dirty = false;
+  m_sequence++;
+  
+  /* Pack up the record. */
+  memcpy( l_record, HISCORE_MAGIC, 4 );
+  l_record[4] = HISCORE_VERSION;
+  l_record[5] = MAX_SCORES;
+  l_record[6] = m_sequence & 0xff;
+  l_record[7] = m_sequence >> 8;
+  
+  l_entry = &l_record[8];
+  for ( l_index = 0; l_index < MAX_SCORES; l_index++ )
+  {
+    l_entry[0] = m_scores[l_index].score & 0xff;
+    l_entry[1] = ( m_scores[l_index].score >> 8 ) & 0xff;
+    l_entry[2] = ( m_scores[l_index].score >> 16 ) & 0xff;
+    l_entry[3] = ( m_scores[l_index].score >> 24 ) & 0xff;
+    l_entry[4] = m_scores[l_index].name[0];
+    l_entry[5] = m_scores[l_index].name[1];
+    l_entry[6] = m_scores[l_index].name[2];
+    l_entry += HISCORE_ENTRY_SIZE;
+  }
+  
+  l_crc = storage_crc( l_record, HISCORE_RECORD_SIZE - 4 );
+  l_record[HISCORE_RECORD_SIZE-4] = l_crc & 0xff;
+  l_record[HISCORE_RECORD_SIZE-3] = ( l_crc >> 8 ) & 0xff;
+  l_record[HISCORE_RECORD_SIZE-2] = ( l_crc >> 16 ) & 0xff;
+  l_record[HISCORE_RECORD_SIZE-1] = ( l_crc >> 24 ) & 0xff;
+  
+  /* And write it over the older of the two copies. */
+  if ( !storage_write( ( m_sequence & 1 ) * HISCORE_RECORD_SIZE, l_record, HISCORE_RECORD_SIZE ) )
+  {
+    printf( "hiscore: unable to save the high score table\n" );
+  }
+}
+
+
+/*
+ * _hiscore_flush_timer_update - the delayed write, once things are quiet.
+ */
+
+static void _hiscore_flush_timer_update( uint8_t p_timer )
+{
+  _hiscore_flush();
 }
 
 
@@ -74,7 +190,9 @@ void _hiscore_flicker_timer_update( blit::timer &p_timer )
 
 void hiscore_init( void )
 {
-  uint8_t l_index;
+  uint8_t  l_index;
+  uint32_t l_start, l_elapsed;
+  bool     l_loaded;
   
   /* Start by making sure the local storage is clear. */
   for( l_index = 0; l_index < MAX_SCORES; l_index++ )
@@ -82,6 +200,25 @@ void hiscore_init( void )
     m_scores[l_index].score = 0;
     m_scores[l_index].name[0] = m_scores[l_index].name[1] = m_scores[l_index].name[2] = ' '; 
   }
+  m_sequence = 0;
+  m_dirty = false;
+  
+  /* Then pick up the newest good copy from storage; there's only ever the */
+  /* two fixed size slots to look at, so this won't take long.            */
+  l_start = blit::now();
+  l_loaded = _hiscore_load_slot( 0, false );
+  l_loaded = _hiscore_load_slot( 1, l_loaded ) || l_loaded;
+  l_elapsed = blit::now() - l_start;
+  
+  printf( "hiscore: %s in %lums\n", l_loaded ? "table loaded" : "no saved table", 
+          (unsigned long)l_elapsed );
+  if ( l_elapsed > HISCORE_LOAD_BUDGET )
+  {
+    printf( "hiscore: load took longer than the %dms budget\n", HISCORE_LOAD_BUDGET );
+  }
+  
+  /* Set up the delayed write, for when there's something to save. */
+  m_flush_timer = schedule_create( _hiscore_flush_timer_update, HISCORE_FLUSH_DELAY, 1 );
 }
 
 
@@ -108,7 +245,8 @@ uint32_t hiscore_get_score( uint8_t p_position )
 
 /*
  * hiscore_save_score - saves the high score into the appropriate place in 
- *                      the table, and flush to long term storage
+ *                      the table; it will be flushed to long term storage
+ *                      shortly afterwards.
  * 
  * uint32_t - the score that was scored
  * const char * - the scorer of said score!
@@ -147,6 +285,46 @@ void hiscore_save_score( uint32_t p_score, const char *p_name )
   m_scores[l_index].name[0] = p_name[0];
   m_scores[l_index].name[1] = p_name[1];
   m_scores[l_index].name[2] = p_name[2];
+  
+  /* Don't write it out now; wait until the table has been put on screen. */
+  m_dirty = true;
+  schedule_start( m_flush_timer );
+}
+
+
+/*
+ * hiscore_enter - called when the high score table is shown, to set it up.
+ */
+
+void hiscore_enter( void )
+{
+  /* Get hold of the outline font in our new renderer. */
+  memcpy( &m_outline_font, bee_text_create_fixed_font( outline_font ), sizeof( bee_font_t ) );
+  
+  /* The background gradient never changes shape, so work it out just once. */
+  m_gradient = effect_gradient_create();
+  m_backdrop = effect_backdrop_create( m_gradient );
+  
+  /* And start things flickering; the first frame always needs drawing. */
+  effect_flicker_start();
+  m_redraw = true;
+}
+
+
+/*
+ * hiscore_exit - called when we leave the high score table, to tidy up.
+ */
+
+void hiscore_exit( void )
+{
+  /* If the write is still pending, get it done before the game starts. */
+  schedule_stop( m_flush_timer );
+  _hiscore_flush();
+  
+  effect_flicker_stop();
+  m_gradient = NULL;
+  m_backdrop = false;
+  indexed_release();
 }
 
 
@@ -158,17 +336,9 @@ void hiscore_save_score( uint32_t p_score, const char *p_name )
 
 gamestate_t hiscore_update( void )
 {
-  /* If it's not running, we need to set up the flicker timer. */
-  if ( !m_flicker_timer.started )
-  {
-    m_flicker_timer.init( _hiscore_flicker_timer_update, 20, -1 );
-    m_flicker_timer.start();
-  }
-  
   /* Check to see if the player has pressed the start button. */
   if ( blit::pressed( blit::button::A ) )
   {
-    m_flicker_timer.stop();
     return STATE_GAME;
   }
   
@@ -179,33 +349,36 @@ gamestate_t hiscore_update( void )
 
 /*
  * hiscore_render - renders the high score display in the normal gameloop.
+ *
+ * Returns bool, true if anything was drawn.
  */
 
-void hiscore_render( void )
+bool hiscore_render( void )
 {
   uint8_t       l_index;
-  uint16_t      l_row;
   bee_point_t   l_point;
-  bee_font_t    l_outline_font;
+  
+  /* If nothing has moved since last time, the screen is still good. */
+  if ( ( !m_redraw ) && ( m_generation == effect_generation() ) )
+  {
+    return false;
+  }
+  m_redraw = false;
+  m_generation = effect_generation();
   
   /* Clear the screen to a nice shifting gradient. */
-  for( l_row = 0; l_row < blit::fb.bounds.h; l_row++ )
+  if ( m_backdrop )
+  {
+    effect_backdrop_render();
+  }
+  else
   {
-    blit::fb.pen( 
-      blit::rgba( 
-        (int)( 64.0f + 48.0f * ( sin( M_PI * 2 / blit::fb.bounds.h * l_row  ) ) ), 
-        0, 
-        (int)( 64.0f + 48.0f * ( cos( M_PI * 2 / blit::fb.bounds.h * l_row ) ) ), 
-        255 
-      )
-    );
-    blit::fb.line( point( 0, ( l_row + m_gradient_row ) % blit::fb.bounds.h ), 
-             point( blit::fb.bounds.w, ( l_row + m_gradient_row ) % blit::fb.bounds.h ) );
+    effect_gradient_render( m_gradient );
   }
   
-  /* Get hold of the outline font in our new renderer. */
-  memcpy( &l_outline_font, bee_text_create_fixed_font( outline_font ), sizeof( bee_font_t ) );
-  bee_text_set_font( &l_outline_font );
+  /* Use the outline font we picked up on the way in. */
+  TRACE_BEGIN( "text" );
+  bee_text_set_font( &m_outline_font );
   
   /* Title the screen, although it's probably pretty obvious... */
   blit::fb.pen( rgba( 255, 255, 255, 255 ) );
@@ -230,9 +403,11 @@ void hiscore_render( void )
   }
   
   /* Lastly, the text inviting the user to press the start button. */
-  blit::fb.pen( m_text_colour );
+  blit::fb.pen( effect_text_colour() );
   l_point.y = 100;
   bee_text( &l_point, BEE_ALIGN_CENTRE, "PRESS 'A' TO START" );
+  TRACE_END( "text" );
+  return true;
 }
 
 
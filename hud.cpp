@@ -0,0 +1,343 @@
+/*
+ * hud.cpp - part of 32Blox, a breakout game for the 32blit built to
+ * explore the API.
+ *
+ * The heads-up display along the top of the playfield; high score, current
+ * score and remaining lives. None of these change very often, so rather than
+ * formatting and drawing the whole lot every frame, we remember what is on
+ * screen and only redraw the individual digit cells which have changed.
+ *
+ * This relies on the game leaving the top HUD_HEIGHT rows of the framebuffer
+ * alone, so that whatever we drew last time is still there.
+ *
+ * Please note that this is a first attempt at understanding a somewhat fluid
+ * API on a shiny new bit of kit, so it probably is not full of 'best practice'.
+ * It will hopefully serve as some sort of starting point, however.
+ *
+ * Coyright (C) 2020 Pete Favelle <pete@fsquared.co.uk>
+ *
+ * This software is provided under the MIT License. See LICENSE.txt for details.
+ */
+
+/* System headers. */
+
+#include <string.h>
+
+
+/* Local headers. */
+
+#include "32blit.hpp"
+#include "32blox.hpp"
+
+#include "32bee.h"
+
+
+/* Constants. */
+
+#define HUD_CELL_WIDTH    6     /* Advance of a minimal font character.  */
+#define HUD_MIN_DIGITS    5     /* Scores are zero padded to this width. */
+#define HUD_MAX_DIGITS    10    /* Enough for any uint32_t.              */
+#define HUD_LABEL_CELLS   3     /* "HI:" or "SC:"                        */
+#define HUD_LIVES_LEFT    40    /* The lives live between the two scores */
+#define HUD_LIVES_WIDTH   80
+
+
+/* Module variables. */
+
+typedef struct {
+  const char *label;
+  bool        right;                        /* Anchored to the right edge? */
+  uint32_t    value;                        /* The value we've been given. */
+  uint32_t    drawn;                        /* The value on screen now.    */
+  char        shown[HUD_MAX_DIGITS];        /* The digits on screen now.   */
+  uint8_t     count;                        /* How many digits are shown.  */
+} hud_field_t;
+
+static hud_field_t  m_fields[2] = {
+                      { "HI:", false, 0, 0, { 0 }, 0 },
+                      { "SC:", true,  0, 0, { 0 }, 0 }
+                    };
+static uint8_t      m_lives, m_shown_lives;
+static rgba         m_background[HUD_HEIGHT];
+static bee_font_t   m_minimal_font;
+static bool         m_invalid;
+static rect         m_dirty;
+
+
+/* Module functions. */
+
+/*
+ * _hud_dirty - extends the dirty rectangle to cover the given area.
+ */
+
+static void _hud_dirty( int16_t p_x, int16_t p_width )
+{
+  int16_t l_right;
+
+  /* An empty dirty rect simply becomes the new area. */
+  if ( m_dirty.w == 0 )
+  {
+    m_dirty = rect( p_x, 0, p_width, HUD_HEIGHT );
+    return;
+  }
+
+  /* Otherwise, stretch it to fit. */
+  l_right = m_dirty.x + m_dirty.w;
+  if ( p_x + p_width > l_right )
+  {
+    l_right = p_x + p_width;
+  }
+  if ( p_x < m_dirty.x )
+  {
+    m_dirty.x = p_x;
+  }
+  m_dirty.w = l_right - m_dirty.x;
+}
+
+
+/*
+ * _hud_clear - repaints the background over a span of the HUD.
+ */
+
+static void _hud_clear( int16_t p_x, int16_t p_width )
+{
+  uint8_t l_row;
+
+  for ( l_row = 0; l_row < HUD_HEIGHT; l_row++ )
+  {
+    blit::fb.pen( m_background[l_row] );
+    blit::fb.line( point( p_x, l_row ), point( p_x + p_width - 1, l_row ) );
+  }
+  _hud_dirty( p_x, p_width );
+}
+
+
+/*
+ * _hud_cell_x - works out the screen column of a given cell in a field.
+ */
+
+static int16_t _hud_cell_x( const hud_field_t *p_field, uint8_t p_cell )
+{
+  if ( p_field->right )
+  {
+    return ( blit::fb.bounds.w - 2 ) -
+           ( ( HUD_LABEL_CELLS + p_field->count - p_cell ) * HUD_CELL_WIDTH );
+  }
+  return 1 + ( p_cell * HUD_CELL_WIDTH );
+}
+
+
+/*
+ * _hud_draw_cell - draws a single character into a cell of a field.
+ */
+
+static void _hud_draw_cell( const hud_field_t *p_field, uint8_t p_cell, char p_char )
+{
+  bee_point_t l_point;
+
+  l_point.x = _hud_cell_x( p_field, p_cell );
+  l_point.y = 1;
+  blit::fb.pen( rgba( 255, 255, 255, 255 ) );
+  TRACE_BEGIN( "text" );
+  bee_text( &l_point, BEE_ALIGN_NONE, "%c", p_char );
+  TRACE_END( "text" );
+}
+
+
+/*
+ * _hud_update_field - brings a field on screen up to date with its value,
+ *                     redrawing as few cells as we can get away with.
+ */
+
+static void _hud_update_field( hud_field_t *p_field, bool p_force )
+{
+  char     l_digits[HUD_MAX_DIGITS];
+  uint8_t  l_count, l_index;
+  uint32_t l_value;
+
+  /* Nothing to do if the value on screen is still right. */
+  if ( ( !p_force ) && ( p_field->value == p_field->drawn ) )
+  {
+    return;
+  }
+  p_field->drawn = p_field->value;
+
+  /* Split the value into digits, most significant first, zero padded. */
+  l_count = 0;
+  l_value = p_field->value;
+  do
+  {
+    l_digits[HUD_MAX_DIGITS - ++l_count] = '0' + ( l_value % 10 );
+    l_value /= 10;
+  } while ( l_value > 0 );
+  while ( l_count < HUD_MIN_DIGITS )
+  {
+    l_digits[HUD_MAX_DIGITS - ++l_count] = '0';
+  }
+  memmove( l_digits, &l_digits[HUD_MAX_DIGITS - l_count], l_count );
+
+  /* If the width has changed, everything moves so redraw the lot. */
+  if ( ( p_force ) || ( l_count != p_field->count ) )
+  {
+    if ( p_field->count > 0 )
+    {
+      _hud_clear( _hud_cell_x( p_field, 0 ),
+                  ( HUD_LABEL_CELLS + p_field->count ) * HUD_CELL_WIDTH );
+    }
+    p_field->count = l_count;
+    _hud_clear( _hud_cell_x( p_field, 0 ),
+                ( HUD_LABEL_CELLS + l_count ) * HUD_CELL_WIDTH );
+
+    for ( l_index = 0; l_index < HUD_LABEL_CELLS; l_index++ )
+    {
+      _hud_draw_cell( p_field, l_index, p_field->label[l_index] );
+    }
+    for ( l_index = 0; l_index < l_count; l_index++ )
+    {
+      _hud_draw_cell( p_field, HUD_LABEL_CELLS + l_index, l_digits[l_index] );
+    }
+    memcpy( p_field->shown, l_digits, l_count );
+    return;
+  }
+
+  /* Otherwise, only touch the digits which are actually different. */
+  for ( l_index = 0; l_index < l_count; l_index++ )
+  {
+    if ( l_digits[l_index] != p_field->shown[l_index] )
+    {
+      _hud_clear( _hud_cell_x( p_field, HUD_LABEL_CELLS + l_index ), HUD_CELL_WIDTH );
+      _hud_draw_cell( p_field, HUD_LABEL_CELLS + l_index, l_digits[l_index] );
+      p_field->shown[l_index] = l_digits[l_index];
+    }
+  }
+}
+
+
+/*
+ * _hud_update_lives - redraws the spare bats, which sit between the scores.
+ */
+
+static void _hud_update_lives( void )
+{
+  uint8_t l_index;
+
+  _hud_clear( HUD_LIVES_LEFT, HUD_LIVES_WIDTH );
+  m_shown_lives = m_lives;
+
+  /* Lives are tricky, we can run out of space... */
+  if ( m_lives < 5 )
+  {
+    for ( l_index = 0; l_index < ( m_lives - 1 ); l_index++ )
+    {
+      sprite_render( "bat_normal", 72 - ( ( m_lives - 2 ) * 10 ) + ( l_index * 20 ), 3 );
+    }
+  }
+}
+
+
+/* Functions. */
+
+/*
+ * hud_init - prepares the HUD for a new game; everything will be redrawn
+ *            on the next render.
+ */
+
+void hud_init( void )
+{
+  memcpy( &m_minimal_font, bee_text_create_fixed_font( minimal_font ), sizeof( bee_font_t ) );
+  hud_invalidate();
+}
+
+
+/*
+ * hud_invalidate - forces a full redraw of the HUD, for when something else
+ *                  has scribbled over it (or the background has changed).
+ */
+
+void hud_invalidate( void )
+{
+  m_invalid = true;
+}
+
+
+/*
+ * hud_set_background - sets the background colour for a row of the HUD.
+ *
+ * uint8_t - the row, between 0 and HUD_HEIGHT
+ * rgba    - the colour to fill that row with
+ */
+
+void hud_set_background( uint8_t p_row, rgba p_colour )
+{
+  if ( p_row < HUD_HEIGHT )
+  {
+    m_background[p_row] = p_colour;
+  }
+}
+
+
+/*
+ * hud_set_hiscore, hud_set_score, hud_set_lives - update the values shown;
+ *                  these are cheap, all the work happens in hud_render.
+ */
+
+void hud_set_hiscore( uint32_t p_hiscore )
+{
+  m_fields[0].value = p_hiscore;
+}
+
+void hud_set_score( uint32_t p_score )
+{
+  m_fields[1].value = p_score;
+}
+
+void hud_set_lives( uint8_t p_lives )
+{
+  m_lives = p_lives;
+}
+
+
+/*
+ * hud_render - brings the HUD on screen up to date. If nothing has changed,
+ *              this does nothing at all.
+ *
+ * Returns the rectangle of the screen which was redrawn; zero width if
+ * nothing needed doing.
+ */
+
+rect hud_render( void )
+{
+  uint8_t l_index;
+
+  m_dirty = rect( 0, 0, 0, 0 );
+  bee_text_set_font( &m_minimal_font );
+
+  /* A full redraw repaints the background, and then everything else. */
+  if ( m_invalid )
+  {
+    _hud_clear( 0, blit::fb.bounds.w );
+    for ( l_index = 0; l_index < 2; l_index++ )
+    {
+      m_fields[l_index].count = 0;
+      _hud_update_field( &m_fields[l_index], true );
+    }
+    _hud_update_lives();
+    m_invalid = false;
+    return m_dirty;
+  }
+
+  /* Otherwise, just the bits that have changed. */
+  for ( l_index = 0; l_index < 2; l_index++ )
+  {
+    _hud_update_field( &m_fields[l_index], false );
+  }
+  if ( m_lives != m_shown_lives )
+  {
+    _hud_update_lives();
+  }
+
+  return m_dirty;
+}
+
+
+/* End of hud.cpp */
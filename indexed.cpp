@@ -0,0 +1,292 @@
+/*
+ * indexed.cpp - part of 32Blox, a breakout game for the 32blit built to
+ * explore the API.
+ *
+ * An optional 8-bit, palette indexed, offscreen render target. Anything which
+ * doesn't change shape from frame to frame can be drawn into here once, and
+ * then copied onto the real framebuffer in a single pass each frame; a third
+ * (or a quarter) of the data to shift around compared to full colour pixels.
+ *
+ * Better still, anything which only changes colour (like our scrolling
+ * gradients) can be animated by shuffling the palette, without touching a
+ * single pixel.
+ *
+ * Both the pixels and the palette live in the arena, so this only ever costs
+ * memory while a state is actually using it.
+ *
+ * Runs of entries reserved for animating are kept apart from the colours
+ * handed out one at a time, so a sprite never ends up sharing an entry with
+ * (and cycling along with) a gradient that happens to match it.
+ *
+ * Please note that this is a first attempt at understanding a somewhat fluid
+ * API on a shiny new bit of kit, so it probably is not full of 'best practice'.
+ * It will hopefully serve as some sort of starting point, however.
+ *
+ * Coyright (C) 2020 Pete Favelle <pete@fsquared.co.uk>
+ *
+ * This software is provided under the MIT License. See LICENSE.txt for details.
+ */
+
+/* System headers. */
+
+#include <string.h>
+
+
+/* Local headers. */
+
+#include "32blit.hpp"
+#include "32blox.hpp"
+
+
+/* Module variables. */
+
+static uint8_t     *m_pixels;
+static rgba        *m_base;               /* The palette as it was defined.  */
+static rgba        *m_palette;            /* The palette after any rotation. */
+static uint16_t     m_colours;            /* Entries handed out so far.      */
+static uint8_t      m_shared[INDEXED_COLOURS / 8];  /* Set for single colours. */
+static uint16_t     m_width, m_height;
+
+
+/* Functions. */
+
+/*
+ * indexed_create - sets up an indexed target the size of the screen, cleared
+ *                  to colour 0. It lasts until the arena is next reset.
+ *
+ * Returns bool, true if there was room for it.
+ */
+
+bool indexed_create( void )
+{
+  uint16_t l_index;
+
+  m_width = blit::fb.bounds.w;
+  m_height = blit::fb.bounds.h;
+
+  m_pixels = (uint8_t *)arena_alloc( m_width * m_height );
+  m_base = (rgba *)arena_alloc( sizeof( rgba ) * INDEXED_COLOURS );
+  m_palette = (rgba *)arena_alloc( sizeof( rgba ) * INDEXED_COLOURS );
+  if ( ( m_pixels == NULL ) || ( m_base == NULL ) || ( m_palette == NULL ) )
+  {
+    m_pixels = NULL;
+    return false;
+  }
+
+  memset( m_pixels, 0, m_width * m_height );
+  for ( l_index = 0; l_index < INDEXED_COLOURS; l_index++ )
+  {
+    m_base[l_index] = m_palette[l_index] = rgba( 0, 0, 0, 255 );
+  }
+  memset( m_shared, 0, sizeof( m_shared ) );
+  m_colours = 0;
+  return true;
+}
+
+
+/*
+ * indexed_reserve - reserves a run of palette entries, for things like
+ *                   gradients which want a contiguous range to rotate.
+ *
+ * uint16_t - the number of entries required
+ *
+ * Returns the first index of the run, or INDEXED_FULL if there isn't room.
+ */
+
+uint16_t indexed_reserve( uint16_t p_count )
+{
+  uint16_t l_first = m_colours;
+
+  if ( ( m_pixels == NULL ) || ( m_colours + p_count > INDEXED_COLOURS ) )
+  {
+    return INDEXED_FULL;
+  }
+  m_colours += p_count;
+  return l_first;
+}
+
+
+/*
+ * indexed_set_colour - defines the colour of a palette entry.
+ *
+ * uint8_t - the palette index
+ * rgba    - the colour
+ */
+
+void indexed_set_colour( uint8_t p_index, rgba p_colour )
+{
+  if ( m_pixels == NULL )
+  {
+    return;
+  }
+  m_base[p_index] = m_palette[p_index] = p_colour;
+}
+
+
+/*
+ * indexed_add_colour - finds a palette entry for a colour, adding one if it
+ *                      isn't already there. Only entries added this way are
+ *                      shared; reserved runs may be rotated under us.
+ *
+ * rgba - the colour required
+ *
+ * Returns the palette index, or INDEXED_FULL if we've run out.
+ */
+
+uint16_t indexed_add_colour( rgba p_colour )
+{
+  uint16_t l_index;
+
+  if ( m_pixels == NULL )
+  {
+    return INDEXED_FULL;
+  }
+
+  for ( l_index = 0; l_index < m_colours; l_index++ )
+  {
+    if ( ( m_shared[l_index / 8] & ( 1 << ( l_index % 8 ) ) ) &&
+         ( m_base[l_index].r == p_colour.r ) && ( m_base[l_index].g == p_colour.g ) &&
+         ( m_base[l_index].b == p_colour.b ) )
+    {
+      return l_index;
+    }
+  }
+
+  l_index = indexed_reserve( 1 );
+  if ( l_index != INDEXED_FULL )
+  {
+    indexed_set_colour( l_index, p_colour );
+    m_shared[l_index / 8] |= ( 1 << ( l_index % 8 ) );
+  }
+  return l_index;
+}
+
+
+/*
+ * indexed_plot - sets a single pixel in the target; anything off the edge
+ *                is quietly ignored.
+ *
+ * int16_t - the column
+ * int16_t - the row
+ * uint8_t - the palette index
+ */
+
+void indexed_plot( int16_t p_x, int16_t p_y, uint8_t p_index )
+{
+  if ( ( m_pixels == NULL ) || ( p_x < 0 ) || ( p_y < 0 ) ||
+       ( p_x >= m_width ) || ( p_y >= m_height ) )
+  {
+    return;
+  }
+  m_pixels[ ( p_y * m_width ) + p_x ] = p_index;
+}
+
+
+/*
+ * indexed_hline - fills a whole row of the target with one palette index.
+ *
+ * int16_t - the row
+ * uint8_t - the palette index
+ */
+
+void indexed_hline( int16_t p_y, uint8_t p_index )
+{
+  if ( ( m_pixels == NULL ) || ( p_y < 0 ) || ( p_y >= m_height ) )
+  {
+    return;
+  }
+  memset( &m_pixels[ p_y * m_width ], p_index, m_width );
+}
+
+
+/*
+ * indexed_rotate - rotates a run of palette entries, so that entry
+ *                  first + n shows the colour originally given to entry
+ *                  first + ( n - offset ), wrapping around within the run.
+ *
+ * uint8_t  - the first entry of the run
+ * uint16_t - the number of entries in the run
+ * uint16_t - how far to rotate
+ */
+
+void indexed_rotate( uint8_t p_first, uint16_t p_count, uint16_t p_offset )
+{
+  uint16_t l_index, l_source;
+
+  if ( ( m_pixels == NULL ) || ( p_count == 0 ) || ( p_first + p_count > INDEXED_COLOURS ) )
+  {
+    return;
+  }
+
+  p_offset %= p_count;
+  l_source = p_count - p_offset;
+  for ( l_index = 0; l_index < p_count; l_index++ )
+  {
+    if ( l_source >= p_count )
+    {
+      l_source = 0;
+    }
+    m_palette[p_first + l_index] = m_base[p_first + l_source++];
+  }
+}
+
+
+/*
+ * indexed_render - expands the whole target onto the framebuffer, through
+ *                  the current palette.
+ */
+
+void indexed_render( void )
+{
+  const uint8_t *l_source, *l_end;
+  uint8_t       *l_dest;
+  const rgba    *l_colour;
+  uint16_t       l_row, l_column;
+
+  if ( m_pixels == NULL )
+  {
+    return;
+  }
+
+  /* The lores framebuffer is packed RGB, so we can write it directly. */
+  if ( blit::fb.format == blit::pixel_format::RGB )
+  {
+    l_source = m_pixels;
+    l_end = m_pixels + ( m_width * m_height );
+    l_dest = blit::fb.data;
+    while ( l_source < l_end )
+    {
+      l_colour = &m_palette[*l_source++];
+      *l_dest++ = l_colour->r;
+      *l_dest++ = l_colour->g;
+      *l_dest++ = l_colour->b;
+    }
+    return;
+  }
+
+  /* Otherwise, fall back to letting the engine do it a pixel at a time. */
+  l_source = m_pixels;
+  for ( l_row = 0; l_row < m_height; l_row++ )
+  {
+    for ( l_column = 0; l_column < m_width; l_column++ )
+    {
+      blit::fb.pen( m_palette[*l_source++] );
+      blit::fb.pixel( point( l_column, l_row ) );
+    }
+  }
+}
+
+
+/*
+ * indexed_release - forgets the target; the arena will reclaim the memory.
+ */
+
+void indexed_release( void )
+{
+  m_pixels = NULL;
+  m_base = m_palette = NULL;
+  m_colours = 0;
+}
+
+
+/* End of indexed.cpp */
@@ -3,7 +3,17 @@
  * explore the API.
  *
  * Defines the game levels, and maintains the current level state as well.
- * Levels are grids of up to 20x20 blocks.
+ * Levels are grids of up to BOARD_MAX_COLUMNS by BOARD_MAX_ROWS bricks, and
+ * each one chooses its own size.
+ *
+ * As well as the grid, we keep a mask of which columns in each row still have
+ * a brick in (and which rows have any at all), along with a count per row;
+ * anyone who wants to visit the bricks can skip empty rows and columns
+ * outright, so it gets cheaper as the board is cleared.
+ *
+ * Every hit on a brick is also written to a small journal, which anyone
+ * interested can subscribe to and drain each frame; that way they only have
+ * to deal with what changed, rather than rescanning the whole board.
  *
  * Please note that this is a first attempt at understanding a somewhat fluid
  * API on a shiny new bit of kit, so it probably is not full of 'best practice'.
@@ -27,7 +37,20 @@
 
 /* Module variables. */
 
-static uint8_t m_current_level[BOARD_HEIGHT][BOARD_WIDTH];
+static uint8_t      m_current_level[BOARD_MAX_ROWS][BOARD_MAX_COLUMNS];
+static uint8_t      m_columns, m_rows;
+static bricktype_t  m_bricktypes[BRICK_TYPES];
+static uint16_t     m_bricks;
+static uint32_t     m_row_masks[BOARD_MAX_ROWS];  /* Columns with a brick in. */
+static uint8_t      m_row_bricks[BOARD_MAX_ROWS];
+static uint32_t     m_rows_mask;                  /* Rows with a brick in.    */
+static brickevent_t m_events[LEVEL_EVENTS];
+static uint32_t     m_event_head;             /* Total events ever written.   */
+static uint32_t     m_cursors[LEVEL_SUBSCRIBERS];
+static bool         m_subscribed[LEVEL_SUBSCRIBERS];
+
+static_assert( BOARD_MAX_COLUMNS <= 32, "a row of columns must fit a mask" );
+static_assert( BOARD_MAX_ROWS <= 32, "the rows must fit a mask" );
 
 
 /* Raw level data. */
@@ -35,6 +58,39 @@ static uint8_t m_current_level[BOARD_HEIGHT][BOARD_WIDTH];
 #include "levels.h"
 
 
+/* Module functions. */
+
+/*
+ * _level_build_masks - works out the row masks and counts, the slow way.
+ */
+
+static void _level_build_masks( void )
+{
+  uint8_t  l_row, l_column;
+  
+  m_bricks = 0;
+  m_rows_mask = 0;
+  for ( l_row = 0; l_row < BOARD_MAX_ROWS; l_row++ )
+  {
+    m_row_masks[l_row] = 0;
+    m_row_bricks[l_row] = 0;
+    for ( l_column = 0; ( l_row < m_rows ) && ( l_column < m_columns ); l_column++ )
+    {
+      if ( m_current_level[l_row][l_column] > 0 )
+      {
+        m_row_masks[l_row] |= ( 1UL << l_column );
+        m_row_bricks[l_row]++;
+      }
+    }
+    if ( m_row_bricks[l_row] > 0 )
+    {
+      m_rows_mask |= ( 1UL << l_row );
+      m_bricks += m_row_bricks[l_row];
+    }
+  }
+}
+
+
 /* Functions. */
 
 using namespace blit;
@@ -48,18 +104,104 @@ using namespace blit;
 
 void level_init( uint8_t p_level )
 {
-  /* Quite easy really, we just copy the whole block of level data. */
-  memcpy( m_current_level, &m_levels[ p_level ], 
-          sizeof( uint8_t ) * ( BOARD_HEIGHT * BOARD_WIDTH ) );
+  uint8_t l_index;
+
+  /* Find the stage to play; once we run out, the last one just repeats. */
+  if ( p_level >= sizeof( m_stages ) / sizeof( m_stages[0] ) )
+  {
+    p_level = ( sizeof( m_stages ) / sizeof( m_stages[0] ) ) - 1;
+  }
+  level_load( m_stages[p_level].columns, m_stages[p_level].rows, m_stages[p_level].bricks );
+
+  /* And resolve the brick types, so nobody has to look sprites up by name. */
+  for ( l_index = 0; l_index < BRICK_TYPES; l_index++ )
+  {
+    m_bricktypes[l_index].sprite = ( m_brickdefs[l_index].sprite == NULL )
+                                 ? SPRITE_NONE : sprite_id( m_brickdefs[l_index].sprite );
+    m_bricktypes[l_index].hits = l_index;
+    m_bricktypes[l_index].score = m_brickdefs[l_index].score;
+    m_bricktypes[l_index].flags = m_brickdefs[l_index].flags;
+    m_bricktypes[l_index].debris = rgba( m_brickdefs[l_index].debris[0], m_brickdefs[l_index].debris[1],
+                                         m_brickdefs[l_index].debris[2], 255 );
+  }
+}
+
+
+/*
+ * level_load - sets up the board from a block of brick data, of any size up
+ *              to BOARD_MAX_COLUMNS by BOARD_MAX_ROWS.
+ *
+ * uint8_t         - the number of bricks across
+ * uint8_t         - the number of bricks down
+ * const uint8_t * - the brick types, row by row
+ */
+
+void level_load( uint8_t p_columns, uint8_t p_rows, const uint8_t *p_bricks )
+{
+  uint8_t l_row;
+
+  m_columns = ( p_columns > BOARD_MAX_COLUMNS ) ? BOARD_MAX_COLUMNS : p_columns;
+  m_rows = ( p_rows > BOARD_MAX_ROWS ) ? BOARD_MAX_ROWS : p_rows;
+
+  /* Copy the bricks in a row at a time, leaving anything else empty. */
+  memset( m_current_level, 0, sizeof( m_current_level ) );
+  for ( l_row = 0; l_row < m_rows; l_row++ )
+  {
+    memcpy( m_current_level[l_row], &p_bricks[ l_row * p_columns ], m_columns );
+  }
+
+  /* Lay the board out to match. */
+  board_init( m_columns, m_rows );
+
+  /* Work out the masks once; hits keep them up to date after that. */
+  _level_build_masks();
+}
+
+
+/*
+ * level_save - writes the state of the board into a snapshot image; just the
+ *              size and the bricks, as the masks can be worked out again.
+ *
+ * uint8_t * - where to write it
+ *
+ * Returns the number of bytes written.
+ */
+
+uint16_t level_save( uint8_t *p_image )
+{
+  uint8_t l_row;
+
+  p_image[0] = m_columns;
+  p_image[1] = m_rows;
+  for ( l_row = 0; l_row < m_rows; l_row++ )
+  {
+    memcpy( &p_image[ 2 + ( l_row * m_columns ) ], m_current_level[l_row], m_columns );
+  }
+  return 2 + ( m_rows * m_columns );
+}
+
+
+/*
+ * level_restore - puts the board back the way level_save found it.
+ *
+ * const uint8_t * - the image to read from
+ *
+ * Returns the number of bytes read.
+ */
+
+uint16_t level_restore( const uint8_t *p_image )
+{
+  level_load( p_image[0], p_image[1], &p_image[2] );
+  return 2 + ( p_image[0] * p_image[1] );
 }
 
 
 /*
  * level_get_line - returns the current bricks in the requested line. 
  *
- * uint8_t - the line of bricks to fetch, between 0 and 10
+ * uint8_t - the line of bricks to fetch, up to board_rows()
  * 
- * Returns a 10 byte array of brick types.
+ * Returns an array of board_columns() brick types.
  */
  
 uint8_t *level_get_line( uint8_t p_line )
@@ -75,40 +217,65 @@ uint8_t *level_get_line( uint8_t p_line )
  * 
  * uint8_t - the row the brick is on
  * uint8_t - the column the brick is in
+ *
+ * Returns the score earned by the hit.
 */
 
-void level_hit_brick( uint8_t p_row, uint8_t p_column )
+uint8_t level_hit_brick( uint8_t p_row, uint8_t p_column )
 {
+  uint8_t       l_score;
+  brickevent_t *l_event;
+  TRACE_SCOPE( "level_hit_brick" );
+  
   /* Sanity check the location. */
-  if ( ( p_row >= BOARD_HEIGHT ) || ( p_column >= BOARD_WIDTH ) )
+  if ( ( p_row >= m_rows ) || ( p_column >= m_columns ) )
   {
-    return;
+    return 0;
   }
   
   /* And only act if a brick is there. */
   if ( m_current_level[p_row][p_column] == 0 )
   {
-    return;
+    return 0;
   }
   
-  /* For now, we'll just decrement the brick type. */
-  m_current_level[p_row][p_column]--;
+  /* Score it as it was, then knock it down a type. */
+  l_score = level_get_bricktype( m_current_level[p_row][p_column] )->score;
+  l_event = &m_events[ m_event_head++ % LEVEL_EVENTS ];
+  l_event->row = p_row;
+  l_event->column = p_column;
+  l_event->old_type = m_current_level[p_row][p_column]--;
+  l_event->new_type = m_current_level[p_row][p_column];
+  l_event->tick = blit::now();
+
+  if ( l_event->new_type == 0 )
+  {
+    m_bricks--;
+    m_row_masks[p_row] &= ~( 1UL << p_column );
+    if ( --m_row_bricks[p_row] == 0 )
+    {
+      m_rows_mask &= ~( 1UL << p_row );
+    }
+  }
+  return l_score;
 }
 
-const char *level_get_bricktype( uint8_t p_bricktype )
+
+/*
+ * level_get_bricktype - returns the details of a brick type.
+ *
+ * uint8_t - the brick type, as found in the level
+ *
+ * Returns the brick type details; anything unknown is the toughest we have.
+ */
+
+const bricktype_t *level_get_bricktype( uint8_t p_bricktype )
 {
-  switch( p_bricktype )
+  if ( p_bricktype >= BRICK_TYPES )
   {
-    case 3:
-      return "brick_yellow";
-    case 2:
-      return "brick_orange";
-    case 1:
-      return "brick_red";
+    p_bricktype = BRICK_TYPES - 1;
   }
-  
-  /* Default to a red brick, should never be reached though... */
-  return "brick_red";
+  return &m_bricktypes[p_bricktype];
 }
 
 
@@ -120,21 +287,122 @@ const char *level_get_bricktype( uint8_t p_bricktype )
 
 uint16_t level_get_bricks( void )
 {
-  uint8_t  l_row, l_column;
-  uint16_t l_bricks = 0;
-  
-  /* Simply count the non-zero entries in the level. */
-  for ( l_row = 0; l_row < BOARD_HEIGHT; l_row++ )
+  return m_bricks;
+}
+
+
+/*
+ * level_get_rows - returns which rows still have any bricks in.
+ *
+ * Returns a mask, with bit n set if row n has a brick in.
+ */
+
+uint32_t level_get_rows( void )
+{
+  return m_rows_mask;
+}
+
+
+/*
+ * level_get_row_mask - returns which columns of a row still have a brick in.
+ *
+ * uint8_t - the row
+ *
+ * Returns a mask, with bit n set if column n has a brick in.
+ */
+
+uint32_t level_get_row_mask( uint8_t p_row )
+{
+  return ( p_row < BOARD_MAX_ROWS ) ? m_row_masks[p_row] : 0;
+}
+
+
+/*
+ * level_get_row_bricks - returns the number of bricks left in a row.
+ *
+ * uint8_t - the row
+ *
+ * Returns a brick count.
+ */
+
+uint8_t level_get_row_bricks( uint8_t p_row )
+{
+  return ( p_row < BOARD_MAX_ROWS ) ? m_row_bricks[p_row] : 0;
+}
+
+
+/*
+ * level_subscribe - signs up to receive brick events; only events from now
+ *                   on will be seen.
+ *
+ * Returns a subscriber ID, or LEVEL_NO_SUBSCRIBER if we're full.
+ */
+
+uint8_t level_subscribe( void )
+{
+  uint8_t l_index;
+
+  for ( l_index = 0; l_index < LEVEL_SUBSCRIBERS; l_index++ )
   {
-    for ( l_column = 0; l_column < BOARD_WIDTH; l_column++ )
+    if ( !m_subscribed[l_index] )
     {
-      if ( m_current_level[l_row][l_column] > 0 )
-      {
-        l_bricks++;
-      }
+      m_subscribed[l_index] = true;
+      m_cursors[l_index] = m_event_head;
+      return l_index;
     }
   }
-  return l_bricks;
+  return LEVEL_NO_SUBSCRIBER;
+}
+
+
+/*
+ * level_unsubscribe - gives up a subscription, freeing it for someone else.
+ *
+ * uint8_t - the subscriber ID, from level_subscribe
+ */
+
+void level_unsubscribe( uint8_t p_subscriber )
+{
+  if ( p_subscriber < LEVEL_SUBSCRIBERS )
+  {
+    m_subscribed[p_subscriber] = false;
+  }
+}
+
+
+/*
+ * level_next_event - fetches the next brick event a subscriber hasn't seen.
+ *                    Anyone who falls more than LEVEL_EVENTS behind simply
+ *                    loses the oldest ones.
+ *
+ * uint8_t        - the subscriber ID, from level_subscribe
+ * brickevent_t * - where to put the event
+ *
+ * Returns bool, true if there was an event to fetch.
+ */
+
+bool level_next_event( uint8_t p_subscriber, brickevent_t *p_event )
+{
+  if ( ( p_subscriber >= LEVEL_SUBSCRIBERS ) || ( !m_subscribed[p_subscriber] ) )
+  {
+    return false;
+  }
+
+  /* Nothing new? */
+  if ( m_cursors[p_subscriber] == m_event_head )
+  {
+    return false;
+  }
+
+  /* Catch up if the ring has lapped us. */
+  if ( ( m_event_head - m_cursors[p_subscriber] ) > LEVEL_EVENTS )
+  {
+    m_cursors[p_subscriber] = m_event_head - LEVEL_EVENTS;
+  }
+
+  *p_event = m_events[ m_cursors[p_subscriber]++ % LEVEL_EVENTS ];
+  return true;
 }
 
+
 /* End of level.cpp */
@@ -1,7 +1,14 @@
 /*
- * This WILL one day be autogenerated....
+ * The levels WILL one day be autogenerated, like the brick types are....
  */
- 
+
+/*
+ * Brick types, indexed by the values in the levels below; the asset builder
+ * generates these from assets/bricks.txt.
+ */
+
+#include "bricks.h"
+
 static uint8_t m_levels[][10][10] =
 {
   /* Level 0, unusued. */
@@ -52,3 +59,35 @@ static uint8_t m_levels[][10][10] =
     { 9, 9, 9, 9, 9, 9, 9, 9, 9, 9 },
     { 9, 9, 9, 9, 9, 9, 9, 9, 9, 9 } },
 };
+
+
+/* A bigger board, with bricks squeezed down to fit. */
+
+static uint8_t m_level_lattice[12][20] =
+  { { 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3 },
+    { 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3 },
+    { 3, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 3 },
+    { 3, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 3 },
+    { 3, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 3 },
+    { 3, 2, 1, 2, 1, 2, 4, 4, 4, 4, 4, 4, 4, 4, 1, 2, 1, 2, 1, 3 },
+    { 3, 1, 2, 1, 2, 1, 4, 4, 4, 4, 4, 4, 4, 4, 2, 1, 2, 1, 2, 3 },
+    { 3, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 3 },
+    { 3, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 3 },
+    { 3, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 2, 1, 3 },
+    { 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3 },
+    { 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3 } };
+
+
+/* And the order they're played in; anything past the end replays the last. */
+
+static const struct {
+  uint8_t         columns;
+  uint8_t         rows;
+  const uint8_t  *bricks;                     /* Row by row, columns * rows. */
+} m_stages[] =
+{
+  { 10, 10, &m_levels[0][0][0] },             /* 0, unused.                  */
+  { 10, 10, &m_levels[1][0][0] },
+  { 20, 12, &m_level_lattice[0][0] },
+  { 10, 10, &m_levels[2][0][0] }
+};
@@ -0,0 +1,273 @@
+/*
+ * particle.cpp - part of 32Blox, a breakout game for the 32blit built to
+ * explore the API.
+ *
+ * Falling debris, knocked off bricks as they're hit. There can be thousands
+ * of these at once, so they live in a fixed pool of parallel arrays rather
+ * than an array of structures; the update only touches the arrays it needs,
+ * one after the other. Emitting a particle just appends it, and a dead one
+ * is replaced by the last live one, so the pool never has holes in it.
+ *
+ * New debris is emitted by watching the level's brick events, so the level
+ * itself doesn't have to know anything about us.
+ *
+ * Please note that this is a first attempt at understanding a somewhat fluid
+ * API on a shiny new bit of kit, so it probably is not full of 'best practice'.
+ * It will hopefully serve as some sort of starting point, however.
+ *
+ * Coyright (C) 2020 Pete Favelle <pete@fsquared.co.uk>
+ *
+ * This software is provided under the MIT License. See LICENSE.txt for details.
+ */
+
+/* System headers. */
+
+
+
+/* Local headers. */
+
+#include "32blit.hpp"
+#include "32blox.hpp"
+
+
+/* Constants. */
+
+#define PARTICLE_GRAVITY    FIXED( 0.04f )
+#define PARTICLE_LIFE_MIN   40
+#define PARTICLE_LIFE_RANGE 40
+#define PARTICLE_HIT_BURST  12
+#define PARTICLE_KILL_BURST 48
+
+
+/* Module variables. */
+
+static fixed_t      m_x[PARTICLE_MAX], m_y[PARTICLE_MAX];
+static fixed_t      m_dx[PARTICLE_MAX], m_dy[PARTICLE_MAX];
+static uint8_t      m_life[PARTICLE_MAX];   /* Ticks left to live.             */
+static uint8_t      m_colour[PARTICLE_MAX]; /* Index into m_palette.           */
+static uint16_t     m_count;
+static rgba         m_palette[PARTICLE_COLOURS];
+static uint8_t      m_colours;
+static uint8_t      m_subscriber = LEVEL_NO_SUBSCRIBER;
+
+
+/* Module functions. */
+
+/*
+ * _particle_colour - finds the palette entry for a colour, adding it if it's
+ *                    new; once the palette is full, new colours share the
+ *                    last entry.
+ *
+ * rgba - the colour wanted
+ *
+ * Returns the palette index.
+ */
+
+static uint8_t _particle_colour( rgba p_colour )
+{
+  uint8_t l_index;
+
+  for ( l_index = 0; l_index < m_colours; l_index++ )
+  {
+    if ( ( m_palette[l_index].r == p_colour.r ) && ( m_palette[l_index].g == p_colour.g ) &&
+         ( m_palette[l_index].b == p_colour.b ) )
+    {
+      return l_index;
+    }
+  }
+
+  if ( m_colours == PARTICLE_COLOURS )
+  {
+    return PARTICLE_COLOURS - 1;
+  }
+  m_palette[m_colours] = p_colour;
+  return m_colours++;
+}
+
+
+/*
+ * _particle_spread - a random value, evenly spread either side of zero.
+ *
+ * fixed_t - the furthest from zero it can be
+ *
+ * Returns the value.
+ */
+
+static fixed_t _particle_spread( fixed_t p_range )
+{
+  return (fixed_t)( blit::random() % ( 2 * p_range + 1 ) ) - p_range;
+}
+
+
+/*
+ * _particle_kill - removes a particle, by moving the last one into its slot.
+ *
+ * uint16_t - the particle to remove
+ */
+
+static void _particle_kill( uint16_t p_index )
+{
+  m_count--;
+  m_x[p_index] = m_x[m_count];
+  m_y[p_index] = m_y[m_count];
+  m_dx[p_index] = m_dx[m_count];
+  m_dy[p_index] = m_dy[m_count];
+  m_life[p_index] = m_life[m_count];
+  m_colour[p_index] = m_colour[m_count];
+}
+
+
+/* Functions. */
+
+/*
+ * particle_init - empties the pool, and starts watching for brick hits.
+ */
+
+void particle_init( void )
+{
+  m_count = 0;
+  m_colours = 0;
+  if ( m_subscriber == LEVEL_NO_SUBSCRIBER )
+  {
+    m_subscriber = level_subscribe();
+  }
+}
+
+
+/*
+ * particle_exit - stops watching for brick hits; anything still in flight
+ *                 is simply forgotten.
+ */
+
+void particle_exit( void )
+{
+  level_unsubscribe( m_subscriber );
+  m_subscriber = LEVEL_NO_SUBSCRIBER;
+  m_count = 0;
+}
+
+
+/*
+ * particle_emit - throws out a burst of particles from a point. If the pool
+ *                 is full, the rest of the burst is quietly dropped.
+ *
+ * fixed_t  - the column (x) to emit from
+ * fixed_t  - the row (y) to emit from
+ * uint16_t - the number of particles
+ * rgba     - their colour
+ */
+
+void particle_emit( fixed_t p_x, fixed_t p_y, uint16_t p_count, rgba p_colour )
+{
+  uint8_t l_colour = _particle_colour( p_colour );
+
+  while ( ( p_count-- > 0 ) && ( m_count < PARTICLE_MAX ) )
+  {
+    m_x[m_count] = p_x;
+    m_y[m_count] = p_y;
+    m_dx[m_count] = _particle_spread( FIXED_ONE );
+    m_dy[m_count] = _particle_spread( FIXED_ONE ) - ( FIXED_ONE / 2 );
+    m_life[m_count] = PARTICLE_LIFE_MIN + ( blit::random() % PARTICLE_LIFE_RANGE );
+    m_colour[m_count] = l_colour;
+    m_count++;
+  }
+}
+
+
+/*
+ * particle_update - emits debris for any new brick hits, and then moves
+ *                   everything on by a tick.
+ */
+
+void particle_update( void )
+{
+  brickevent_t  l_event;
+  rect          l_brick;
+  uint16_t      l_index;
+  TRACE_SCOPE( "particle_update" );
+
+  /* Every hit chips a few bits off; clearing a brick shatters it. */
+  while ( level_next_event( m_subscriber, &l_event ) )
+  {
+    l_brick = board_brick( l_event.row, l_event.column );
+    particle_emit( FIXED_FROM_INT( l_brick.x + ( l_brick.w / 2 ) ),
+                   FIXED_FROM_INT( l_brick.y + ( l_brick.h / 2 ) ),
+                   ( l_event.new_type == 0 ) ? PARTICLE_KILL_BURST : PARTICLE_HIT_BURST,
+                   level_get_bricktype( l_event.old_type )->debris );
+  }
+
+  /* Integrate everything in one pass; gravity first, then position. */
+  for ( l_index = 0; l_index < m_count; l_index++ )
+  {
+    m_dy[l_index] += PARTICLE_GRAVITY;
+    m_x[l_index] += m_dx[l_index];
+    m_y[l_index] += m_dy[l_index];
+  }
+
+  /* And then sweep out anything which has expired, or fallen off screen. */
+  /* Killing one pulls the last one into its place, so check that too.    */
+  l_index = 0;
+  while ( l_index < m_count )
+  {
+    if ( ( --m_life[l_index] == 0 ) ||
+         ( m_x[l_index] < 0 ) || ( m_x[l_index] >= FIXED_FROM_INT( blit::fb.bounds.w ) ) ||
+         ( m_y[l_index] >= FIXED_FROM_INT( blit::fb.bounds.h ) ) )
+    {
+      _particle_kill( l_index );
+      continue;
+    }
+    l_index++;
+  }
+}
+
+
+/*
+ * particle_render - draws all the live particles, as single pixels.
+ */
+
+void particle_render( void )
+{
+  uint16_t  l_index;
+  int16_t   l_x, l_y;
+  uint8_t   l_pen = PARTICLE_COLOURS;
+  uint8_t  *l_dest;
+  TRACE_SCOPE( "particle_render" );
+
+  /* The lores framebuffer is packed RGB, so we can write it directly. */
+  if ( blit::fb.format == blit::pixel_format::RGB )
+  {
+    for ( l_index = 0; l_index < m_count; l_index++ )
+    {
+      l_x = FIXED_INT( m_x[l_index] );
+      l_y = FIXED_INT( m_y[l_index] );
+      if ( l_y < HUD_HEIGHT + 1 )
+      {
+        continue;
+      }
+      l_dest = blit::fb.data + ( ( ( l_y * blit::fb.bounds.w ) + l_x ) * 3 );
+      *l_dest++ = m_palette[m_colour[l_index]].r;
+      *l_dest++ = m_palette[m_colour[l_index]].g;
+      *l_dest = m_palette[m_colour[l_index]].b;
+    }
+    return;
+  }
+
+  /* Otherwise let the engine do it, only changing pen when we have to. */
+  for ( l_index = 0; l_index < m_count; l_index++ )
+  {
+    l_y = FIXED_INT( m_y[l_index] );
+    if ( l_y < HUD_HEIGHT + 1 )
+    {
+      continue;
+    }
+    if ( m_colour[l_index] != l_pen )
+    {
+      l_pen = m_colour[l_index];
+      blit::fb.pen( m_palette[l_pen] );
+    }
+    blit::fb.pixel( point( FIXED_INT( m_x[l_index] ), l_y ) );
+  }
+}
+
+
+/* End of particle.cpp */
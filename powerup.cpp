@@ -0,0 +1,232 @@
+/*
+ * powerup.cpp - part of 32Blox, a breakout game for the 32blit built to
+ * explore the API.
+ *
+ * Power ups, which sometimes drop out of a brick when it's destroyed and
+ * fall towards the player's bat. Like the debris, they live in a fixed pool
+ * of parallel arrays, and are found by watching the level's brick events.
+ *
+ * The bat never leaves its row, so catching one is just a check for having
+ * crossed the top of the bat this tick, and then a span of columns; no
+ * sprite collisions required.
+ *
+ * Please note that this is a first attempt at understanding a somewhat fluid
+ * API on a shiny new bit of kit, so it probably is not full of 'best practice'.
+ * It will hopefully serve as some sort of starting point, however.
+ *
+ * Coyright (C) 2020 Pete Favelle <pete@fsquared.co.uk>
+ *
+ * This software is provided under the MIT License. See LICENSE.txt for details.
+ */
+
+/* System headers. */
+
+#include <string.h>
+
+
+/* Local headers. */
+
+#include "32blit.hpp"
+#include "32blox.hpp"
+
+
+/* Constants. */
+
+#define POWERUP_SPEED     FIXED( 0.5f )     /* Rows fallen each tick.         */
+#define POWERUP_CHANCE    6                 /* One in this many bricks drop.  */
+#define POWERUP_WIDTH     8
+#define POWERUP_HEIGHT    4
+
+
+/* Module variables. */
+
+static fixed_t      m_x[POWERUP_DROPS], m_y[POWERUP_DROPS];
+static uint8_t      m_type[POWERUP_DROPS];
+static uint8_t      m_count;
+static uint8_t      m_subscriber = LEVEL_NO_SUBSCRIBER;
+static const struct {
+  uint8_t r, g, b;
+}                   m_colours[POWERUP_MAX] =
+{
+  { 80, 160, 255 },                         /* POWERUP_MULTIBALL */
+  { 80, 220, 80 },                          /* POWERUP_WIDE      */
+  { 200, 80, 220 }                          /* POWERUP_SLOW      */
+};
+
+
+/* Module functions. */
+
+/*
+ * _powerup_kill - removes a drop, by moving the last one into its slot.
+ *
+ * uint8_t - the drop to remove
+ */
+
+static void _powerup_kill( uint8_t p_index )
+{
+  m_count--;
+  m_x[p_index] = m_x[m_count];
+  m_y[p_index] = m_y[m_count];
+  m_type[p_index] = m_type[m_count];
+}
+
+
+/* Functions. */
+
+/*
+ * powerup_init - clears out any drops, and starts watching for bricks.
+ */
+
+void powerup_init( void )
+{
+  m_count = 0;
+  if ( m_subscriber == LEVEL_NO_SUBSCRIBER )
+  {
+    m_subscriber = level_subscribe();
+  }
+}
+
+
+/*
+ * powerup_exit - stops watching for bricks; anything still falling is lost.
+ */
+
+void powerup_exit( void )
+{
+  level_unsubscribe( m_subscriber );
+  m_subscriber = LEVEL_NO_SUBSCRIBER;
+  m_count = 0;
+}
+
+
+/*
+ * powerup_update - drops new power ups from destroyed bricks, moves them all
+ *                  down a tick, and sees which of them the bat has caught.
+ *
+ * bat_t - the player's bat
+ *
+ * Returns a mask of ( 1 << powerup_t ) for everything caught this tick.
+ */
+
+uint8_t powerup_update( bat_t p_bat )
+{
+  brickevent_t  l_event;
+  rect          l_brick;
+  uint8_t       l_index, l_caught = 0;
+  fixed_t       l_top, l_last, l_reach;
+  TRACE_SCOPE( "powerup_update" );
+
+  /* Only bricks which are completely destroyed have a chance of dropping. */
+  while ( level_next_event( m_subscriber, &l_event ) )
+  {
+    if ( ( l_event.new_type != 0 ) || ( m_count == POWERUP_DROPS ) ||
+         ( random_range( POWERUP_CHANCE ) != 0 ) )
+    {
+      continue;
+    }
+    l_brick = board_brick( l_event.row, l_event.column );
+    m_x[m_count] = FIXED_FROM_INT( l_brick.x + ( l_brick.w / 2 ) );
+    m_y[m_count] = FIXED_FROM_INT( l_brick.y + ( l_brick.h / 2 ) );
+    m_type[m_count] = random_range( POWERUP_MAX );
+    m_count++;
+  }
+
+  /* Everything falls together. A drop is caught if it has reached the */
+  /* top of the bat this tick, and it overlaps the bat sideways.        */
+  l_top = FIXED_FROM_INT( p_bat.baseline - ( POWERUP_HEIGHT / 2 ) );
+  l_reach = FIXED_FROM_INT( ( p_bat.width + POWERUP_WIDTH ) / 2 );
+  l_index = 0;
+  while ( l_index < m_count )
+  {
+    l_last = m_y[l_index];
+    m_y[l_index] += POWERUP_SPEED;
+    if ( ( l_last < l_top ) && ( m_y[l_index] >= l_top ) &&
+         ( m_x[l_index] > p_bat.position - l_reach ) && ( m_x[l_index] < p_bat.position + l_reach ) )
+    {
+      l_caught |= ( 1 << m_type[l_index] );
+      _powerup_kill( l_index );
+      continue;
+    }
+    if ( m_y[l_index] >= FIXED_FROM_INT( blit::fb.bounds.h + POWERUP_HEIGHT ) )
+    {
+      _powerup_kill( l_index );
+      continue;
+    }
+    l_index++;
+  }
+
+  return l_caught;
+}
+
+
+/*
+ * powerup_save - writes the falling drops into a snapshot image. The whole
+ *                pool is written, so the image is always the same size.
+ *
+ * uint8_t * - where to write it
+ *
+ * Returns the number of bytes written.
+ */
+
+uint16_t powerup_save( uint8_t *p_image )
+{
+  uint16_t l_length = 0;
+  uint8_t  l_index;
+
+  p_image[l_length++] = m_count;
+  for ( l_index = 0; l_index < POWERUP_DROPS; l_index++ )
+  {
+    l_length += snapshot_put_32( &p_image[l_length], m_x[l_index] );
+    l_length += snapshot_put_32( &p_image[l_length], m_y[l_index] );
+    p_image[l_length++] = m_type[l_index];
+  }
+  return l_length;
+}
+
+
+/*
+ * powerup_restore - puts the drops back the way powerup_save found them.
+ *
+ * const uint8_t * - the image to read from
+ *
+ * Returns the number of bytes read.
+ */
+
+uint16_t powerup_restore( const uint8_t *p_image )
+{
+  uint16_t l_length = 0;
+  uint8_t  l_index;
+
+  m_count = ( p_image[0] > POWERUP_DROPS ) ? POWERUP_DROPS : p_image[0];
+  l_length++;
+  for ( l_index = 0; l_index < POWERUP_DROPS; l_index++ )
+  {
+    m_x[l_index] = snapshot_get_32( &p_image[l_length] );
+    m_y[l_index] = snapshot_get_32( &p_image[l_length + 4] );
+    m_type[l_index] = p_image[l_length + 8];
+    l_length += 9;
+  }
+  return l_length;
+}
+
+
+/*
+ * powerup_render - draws any power ups which are falling.
+ */
+
+void powerup_render( void )
+{
+  uint8_t l_index, l_type;
+
+  for ( l_index = 0; l_index < m_count; l_index++ )
+  {
+    l_type = m_type[l_index];
+    blit::fb.pen( rgba( m_colours[l_type].r, m_colours[l_type].g, m_colours[l_type].b, 255 ) );
+    blit::fb.rectangle( rect( FIXED_INT( m_x[l_index] ) - ( POWERUP_WIDTH / 2 ),
+                              FIXED_INT( m_y[l_index] ) - ( POWERUP_HEIGHT / 2 ),
+                              POWERUP_WIDTH, POWERUP_HEIGHT ) );
+  }
+}
+
+
+/* End of powerup.cpp */
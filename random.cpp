@@ -0,0 +1,96 @@
+/*
+ * random.cpp - part of 32Blox, a breakout game for the 32blit built to
+ * explore the API.
+ *
+ * The game's own random numbers; anything which changes how a game plays out
+ * (launch angles, power up drops and so on) draws from here rather than from
+ * blit::random(). It's a small seeded LCG, so that a game started from the
+ * same seed plays out the same way every time, and its state goes into the
+ * snapshots so that rewinding doesn't change what happens next either.
+ *
+ * Purely cosmetic things, like the debris, are free to carry on using
+ * blit::random(); nothing they do ever finds its way back into the game.
+ *
+ * Please note that this is a first attempt at understanding a somewhat fluid
+ * API on a shiny new bit of kit, so it probably is not full of 'best practice'.
+ * It will hopefully serve as some sort of starting point, however.
+ *
+ * Coyright (C) 2020 Pete Favelle <pete@fsquared.co.uk>
+ *
+ * This software is provided under the MIT License. See LICENSE.txt for details.
+ */
+
+/* System headers. */
+
+
+
+/* Local headers. */
+
+#include "32blit.hpp"
+#include "32blox.hpp"
+
+
+/* Module variables. */
+
+static uint32_t     m_state;
+
+
+/* Functions. */
+
+/*
+ * random_seed - starts the sequence again, from a given seed.
+ *
+ * uint32_t - the seed
+ */
+
+void random_seed( uint32_t p_seed )
+{
+  m_state = p_seed;
+}
+
+
+/*
+ * random_range - the next number in the sequence.
+ *
+ * uint16_t - the range wanted
+ *
+ * Returns a value from 0 to one less than the range.
+ */
+
+uint16_t random_range( uint16_t p_range )
+{
+  m_state = ( m_state * 1103515245 ) + 12345;
+  return ( m_state >> 16 ) % p_range;
+}
+
+
+/*
+ * random_save - writes where we are in the sequence into a snapshot image.
+ *
+ * uint8_t * - where to write it
+ *
+ * Returns the number of bytes written.
+ */
+
+uint16_t random_save( uint8_t *p_image )
+{
+  return snapshot_put_32( p_image, m_state );
+}
+
+
+/*
+ * random_restore - picks the sequence up from where random_save left it.
+ *
+ * const uint8_t * - the image to read from
+ *
+ * Returns the number of bytes read.
+ */
+
+uint16_t random_restore( const uint8_t *p_image )
+{
+  m_state = snapshot_get_32( p_image );
+  return 4;
+}
+
+
+/* End of random.cpp */
@@ -0,0 +1,310 @@
+/*
+ * schedule.cpp - part of 32Blox, a breakout game for the 32blit built to
+ * explore the API.
+ *
+ * A very small scheduler, so that we don't need a separate blit::timer for
+ * every little effect and delay. Everything is driven from a single tick
+ * (the time handed to update()), and pending callbacks are kept in a list
+ * sorted by when they are due, so each tick only looks at the ones that are
+ * actually ready to fire. If nothing is scheduled, a tick costs one compare.
+ *
+ * Please note that this is a first attempt at understanding a somewhat fluid
+ * API on a shiny new bit of kit, so it probably is not full of 'best practice'.
+ * It will hopefully serve as some sort of starting point, however.
+ *
+ * Coyright (C) 2020 Pete Favelle <pete@fsquared.co.uk>
+ *
+ * This software is provided under the MIT License. See LICENSE.txt for details.
+ */
+
+/* System headers. */
+
+
+
+/* Local headers. */
+
+#include "32blit.hpp"
+#include "32blox.hpp"
+
+
+/* Module variables. */
+
+static struct {
+  schedule_callback_t callback;
+  uint32_t            interval;
+  int16_t             loops;          /* How many times to fire; -1 forever. */
+  int16_t             remaining;
+  uint32_t            due;
+  uint8_t             next;           /* The next entry in the queue.        */
+  bool                queued;
+}                   m_schedules[MAX_SCHEDULES];
+static uint8_t      m_schedule_count;
+static uint8_t      m_head = SCHEDULE_NONE;
+static uint32_t     m_now;
+
+
+/* Module functions. */
+
+/*
+ * _schedule_unlink - removes an entry from the queue, if it's in it.
+ */
+
+static void _schedule_unlink( uint8_t p_id )
+{
+  uint8_t *l_link;
+
+  /* Walk the links until we find the one pointing at us. */
+  for ( l_link = &m_head; *l_link != SCHEDULE_NONE; l_link = &m_schedules[*l_link].next )
+  {
+    if ( *l_link == p_id )
+    {
+      *l_link = m_schedules[p_id].next;
+      break;
+    }
+  }
+  m_schedules[p_id].queued = false;
+}
+
+
+/*
+ * _schedule_insert - adds an entry into the queue, in due time order.
+ */
+
+static void _schedule_insert( uint8_t p_id )
+{
+  uint8_t *l_link;
+
+  /* Find the first entry due after us; ties keep their insertion order. */
+  for ( l_link = &m_head; *l_link != SCHEDULE_NONE; l_link = &m_schedules[*l_link].next )
+  {
+    if ( (int32_t)( m_schedules[*l_link].due - m_schedules[p_id].due ) > 0 )
+    {
+      break;
+    }
+  }
+  m_schedules[p_id].next = *l_link;
+  m_schedules[p_id].queued = true;
+  *l_link = p_id;
+}
+
+
+/* Functions. */
+
+/*
+ * schedule_create - sets up a scheduled callback. Creating one with a callback
+ *                   we already know about simply reconfigures it, so it's
+ *                   safe to call this every time something gets initialised.
+ *
+ * schedule_callback_t - the function to call when the time comes
+ * uint32_t            - the interval, in ms
+ * int16_t             - how many times to fire once started; -1 for ever
+ *
+ * Returns the ID of the schedule, or SCHEDULE_NONE if we've run out.
+ */
+
+uint8_t schedule_create( schedule_callback_t p_callback, uint32_t p_interval, int16_t p_loops )
+{
+  uint8_t l_index;
+
+  /* See if we already have this one. */
+  for ( l_index = 0; l_index < m_schedule_count; l_index++ )
+  {
+    if ( m_schedules[l_index].callback == p_callback )
+    {
+      break;
+    }
+  }
+
+  /* If not, we need a fresh slot. */
+  if ( l_index == m_schedule_count )
+  {
+    if ( m_schedule_count >= MAX_SCHEDULES )
+    {
+      return SCHEDULE_NONE;
+    }
+    m_schedule_count++;
+  }
+
+  /* Make sure it's not queued up with the old settings. */
+  if ( m_schedules[l_index].queued )
+  {
+    _schedule_unlink( l_index );
+  }
+
+  m_schedules[l_index].callback = p_callback;
+  m_schedules[l_index].interval = p_interval;
+  m_schedules[l_index].loops = ( p_loops == 0 ) ? 1 : p_loops;
+  return l_index;
+}
+
+
+/*
+ * schedule_start - (re)starts a schedule; the first callback will be one
+ *                  interval from now.
+ *
+ * uint8_t - the schedule ID
+ */
+
+void schedule_start( uint8_t p_id )
+{
+  if ( p_id >= m_schedule_count )
+  {
+    return;
+  }
+
+  schedule_start_after( p_id, m_schedules[p_id].interval );
+}
+
+
+/*
+ * schedule_start_after - as schedule_start, but the first callback comes
+ *                        after the given delay rather than the interval;
+ *                        used to pick a schedule up part way through.
+ *
+ * uint8_t  - the schedule ID
+ * uint32_t - how long until the first callback, in ms
+ */
+
+void schedule_start_after( uint8_t p_id, uint32_t p_delay )
+{
+  if ( p_id >= m_schedule_count )
+  {
+    return;
+  }
+
+  if ( m_schedules[p_id].queued )
+  {
+    _schedule_unlink( p_id );
+  }
+  m_schedules[p_id].remaining = m_schedules[p_id].loops;
+  m_schedules[p_id].due = m_now + p_delay;
+  _schedule_insert( p_id );
+}
+
+
+/*
+ * schedule_stop - stops a schedule from firing again.
+ *
+ * uint8_t - the schedule ID
+ */
+
+void schedule_stop( uint8_t p_id )
+{
+  if ( p_id >= m_schedule_count )
+  {
+    return;
+  }
+
+  /* Clearing the count also covers being stopped from inside the callback. */
+  m_schedules[p_id].remaining = 0;
+  if ( m_schedules[p_id].queued )
+  {
+    _schedule_unlink( p_id );
+  }
+}
+
+
+/*
+ * schedule_running - lets us know if a schedule is waiting to fire.
+ *
+ * uint8_t - the schedule ID
+ *
+ * Returns bool, true if the schedule is active.
+ */
+
+bool schedule_running( uint8_t p_id )
+{
+  if ( p_id >= m_schedule_count )
+  {
+    return false;
+  }
+  return m_schedules[p_id].queued;
+}
+
+
+/*
+ * schedule_time_left - works out how long a schedule has until it fires.
+ *
+ * uint8_t - the schedule ID
+ *
+ * Returns the number of ms left; 0 if it's overdue, or not running at all.
+ */
+
+uint32_t schedule_time_left( uint8_t p_id )
+{
+  if ( ( p_id >= m_schedule_count ) || ( !m_schedules[p_id].queued ) ||
+       ( (int32_t)( m_schedules[p_id].due - m_now ) <= 0 ) )
+  {
+    return 0;
+  }
+  return m_schedules[p_id].due - m_now;
+}
+
+
+/*
+ * schedule_next_due - works out how long until the next callback is due.
+ *
+ * uint32_t - the elapsed time (in ms) since the application launched.
+ *
+ * Returns the number of ms to wait; 0 if something is overdue, or 
+ * SCHEDULE_FOREVER if nothing is scheduled at all.
+ */
+
+uint32_t schedule_next_due( uint32_t p_time )
+{
+  if ( m_head == SCHEDULE_NONE )
+  {
+    return SCHEDULE_FOREVER;
+  }
+  if ( (int32_t)( m_schedules[m_head].due - p_time ) <= 0 )
+  {
+    return 0;
+  }
+  return m_schedules[m_head].due - p_time;
+}
+
+
+/*
+ * schedule_tick - the single tick source for everything; fires any callbacks
+ *                 which have come due.
+ *
+ * uint32_t - the elapsed time (in ms) since the application launched.
+ */
+
+void schedule_tick( uint32_t p_time )
+{
+  uint8_t l_id;
+
+  m_now = p_time;
+
+  /* The queue is sorted, so we only ever need to look at the head. */
+  while ( ( m_head != SCHEDULE_NONE ) && ( (int32_t)( m_schedules[m_head].due - m_now ) <= 0 ) )
+  {
+    /* Pop it off before calling, in case the callback fiddles with it. */
+    l_id = m_head;
+    m_head = m_schedules[l_id].next;
+    m_schedules[l_id].queued = false;
+
+    if ( m_schedules[l_id].remaining > 0 )
+    {
+      m_schedules[l_id].remaining--;
+    }
+
+    m_schedules[l_id].callback( l_id );
+
+    /* Requeue it if it's got more to do, and hasn't been restarted already. */
+    if ( ( !m_schedules[l_id].queued ) && ( m_schedules[l_id].remaining != 0 ) )
+    {
+      /* Keep to the cadence, unless we've fallen hopelessly behind. */
+      m_schedules[l_id].due += m_schedules[l_id].interval;
+      if ( (int32_t)( m_schedules[l_id].due - m_now ) <= 0 )
+      {
+        m_schedules[l_id].due = m_now + m_schedules[l_id].interval;
+      }
+      _schedule_insert( l_id );
+    }
+  }
+}
+
+
+/* End of schedule.cpp */
@@ -0,0 +1,478 @@
+/*
+ * snapshot.cpp - part of 32Blox, a breakout game for the 32blit built to
+ * explore the API.
+ *
+ * Snapshots of the whole game state, taken every tick, so that play can be
+ * wound back, or picked up again after the power goes off.
+ *
+ * The state itself is gathered up by the game (and the modules it looks
+ * after) into a flat image. Most of that image is the same from one tick to
+ * the next, so each tick is stored as the difference from the last one; the
+ * two images are XORed together and the result written as runs of unchanged
+ * bytes and changed ones. Every so often a keyframe (the difference from an
+ * empty image) is written instead, so a restore never has far to go.
+ *
+ * Records live in a fixed ring of bytes; when it fills up, the oldest group
+ * of records (a keyframe and everything after it) is thrown away to make
+ * room, so the history is always as long as the budget allows.
+ *
+ * Please note that this is a first attempt at understanding a somewhat fluid
+ * API on a shiny new bit of kit, so it probably is not full of 'best practice'.
+ * It will hopefully serve as some sort of starting point, however.
+ *
+ * Coyright (C) 2020 Pete Favelle <pete@fsquared.co.uk>
+ *
+ * This software is provided under the MIT License. See LICENSE.txt for details.
+ */
+
+/* System headers. */
+
+#include <string.h>
+
+
+/* Local headers. */
+
+#include "32blit.hpp"
+#include "32blox.hpp"
+
+
+/* Constants. */
+
+#define SNAPSHOT_BUDGET     32768               /* Bytes of history kept.    */
+#define SNAPSHOT_RECORDS    1024                /* Ticks of history, at most. */
+#define SNAPSHOT_KEY_EVERY  128                 /* Ticks between keyframes.  */
+#define SNAPSHOT_RUN_MAX    255
+#define SNAPSHOT_MAGIC      0x53584c42          /* 'BLXS'                    */
+#define SNAPSHOT_HEADER     12                  /* Magic, size and CRC.      */
+
+
+/* Module variables. */
+
+static uint8_t      m_ring[SNAPSHOT_BUDGET];
+static struct {
+  uint16_t  offset;                             /* Where it is in m_ring.    */
+  uint16_t  length;                             /* How much of it there is.  */
+  uint16_t  image;                              /* The image size it makes.  */
+  bool      key;
+}                   m_records[SNAPSHOT_RECORDS];
+static uint16_t     m_first;                    /* The oldest record.        */
+static uint16_t     m_count;
+static uint16_t     m_write;                    /* Where the next one goes.  */
+static uint16_t     m_since_key;
+static uint8_t      m_latest[SNAPSHOT_IMAGE_SIZE];
+static uint16_t     m_latest_size;
+static uint8_t      m_image[SNAPSHOT_IMAGE_SIZE];
+
+
+/* Module functions. */
+
+/*
+ * _snapshot_encode - writes out the difference between two images, as pairs
+ *                    of run lengths; a count of bytes to skip, and then a
+ *                    count of changed bytes followed by the changes.
+ *
+ * const uint8_t * - the new image
+ * const uint8_t * - the old image, or NULL for a keyframe
+ * uint16_t        - the size of the images
+ * uint8_t *       - where to write the result, or NULL just to measure it
+ *
+ * Returns the size of the encoded difference.
+ */
+
+static uint16_t _snapshot_encode( const uint8_t *p_new, const uint8_t *p_old, uint16_t p_size, uint8_t *p_output )
+{
+  uint16_t l_pos = 0, l_length = 0, l_skip, l_changed;
+
+  while ( l_pos < p_size )
+  {
+    /* Step over whatever hasn't changed... */
+    for ( l_skip = 0; ( l_pos < p_size ) && ( l_skip < SNAPSHOT_RUN_MAX ); l_skip++, l_pos++ )
+    {
+      if ( p_new[l_pos] != ( ( p_old == NULL ) ? 0 : p_old[l_pos] ) )
+      {
+        break;
+      }
+    }
+
+    /* ...and then gather up what has, as far as the next unchanged byte. */
+    for ( l_changed = 0; ( l_pos + l_changed < p_size ) && ( l_changed < SNAPSHOT_RUN_MAX ); l_changed++ )
+    {
+      if ( p_new[l_pos + l_changed] == ( ( p_old == NULL ) ? 0 : p_old[l_pos + l_changed] ) )
+      {
+        break;
+      }
+    }
+
+    /* Nothing needs writing for unchanged bytes at the very end. */
+    if ( ( l_changed == 0 ) && ( l_pos == p_size ) )
+    {
+      break;
+    }
+
+    if ( p_output != NULL )
+    {
+      p_output[l_length] = l_skip;
+      p_output[l_length + 1] = l_changed;
+      for ( l_skip = 0; l_skip < l_changed; l_skip++ )
+      {
+        p_output[l_length + 2 + l_skip] = p_new[l_pos + l_skip] ^ ( ( p_old == NULL ) ? 0 : p_old[l_pos + l_skip] );
+      }
+    }
+    l_length += 2 + l_changed;
+    l_pos += l_changed;
+  }
+
+  return l_length;
+}
+
+
+/*
+ * _snapshot_decode - applies an encoded difference to an image.
+ *
+ * const uint8_t * - the encoded difference
+ * uint16_t        - the size of it
+ * uint8_t *       - the image to apply it to
+ */
+
+static void _snapshot_decode( const uint8_t *p_input, uint16_t p_length, uint8_t *p_image )
+{
+  uint16_t l_in = 0, l_pos = 0;
+  uint8_t  l_changed;
+
+  while ( l_in < p_length )
+  {
+    l_pos += p_input[l_in];
+    l_changed = p_input[l_in + 1];
+    l_in += 2;
+    while ( l_changed-- > 0 )
+    {
+      p_image[l_pos++] ^= p_input[l_in++];
+    }
+  }
+}
+
+
+/*
+ * _snapshot_drop - throws away the oldest group of records; the keyframe at
+ *                  the front, and the differences that depend on it.
+ */
+
+static void _snapshot_drop( void )
+{
+  do
+  {
+    m_first = ( m_first + 1 ) % SNAPSHOT_RECORDS;
+    m_count--;
+  } while ( ( m_count > 0 ) && ( !m_records[m_first].key ) );
+}
+
+
+/*
+ * _snapshot_make_room - finds space in the ring for a new record, dropping
+ *                       old ones as needed.
+ *
+ * uint16_t - the size of the new record
+ */
+
+static void _snapshot_make_room( uint16_t p_length )
+{
+  /* If it won't fit before the end, start again at the beginning; anything */
+  /* still out past here is older than what's at the start, so goes first.  */
+  if ( m_write + p_length > SNAPSHOT_BUDGET )
+  {
+    while ( ( m_count > 0 ) && ( m_records[m_first].offset >= m_write ) )
+    {
+      _snapshot_drop();
+    }
+    m_write = 0;
+  }
+
+  /* The oldest record is always the next one along, so drop until it's */
+  /* clear of where we want to write (or we've run out of records).     */
+  while ( ( m_count > 0 ) &&
+          ( ( m_count == SNAPSHOT_RECORDS ) ||
+            ( ( m_records[m_first].offset >= m_write ) && ( m_records[m_first].offset < m_write + p_length ) ) ) )
+  {
+    _snapshot_drop();
+  }
+  if ( m_count == 0 )
+  {
+    m_write = 0;
+  }
+}
+
+
+/*
+ * _snapshot_apply - builds the image for a record, from the keyframe before
+ *                   it, and hands it to the game to restore.
+ *
+ * uint16_t - the record, counting from the oldest
+ *
+ * Returns bool, true if the game accepted the image.
+ */
+
+static bool _snapshot_apply( uint16_t p_record )
+{
+  uint16_t l_key, l_index, l_slot;
+
+  /* Back up to the keyframe; the oldest record is always one. */
+  for ( l_key = p_record; l_key > 0; l_key-- )
+  {
+    if ( m_records[ ( m_first + l_key ) % SNAPSHOT_RECORDS ].key )
+    {
+      break;
+    }
+  }
+
+  /* And then play the differences forward from there. */
+  memset( m_image, 0, sizeof( m_image ) );
+  for ( l_index = l_key; l_index <= p_record; l_index++ )
+  {
+    l_slot = ( m_first + l_index ) % SNAPSHOT_RECORDS;
+    _snapshot_decode( &m_ring[m_records[l_slot].offset], m_records[l_slot].length, m_image );
+  }
+
+  l_slot = ( m_first + p_record ) % SNAPSHOT_RECORDS;
+  if ( !game_restore( m_image, m_records[l_slot].image ) )
+  {
+    return false;
+  }
+
+  /* That's where history picks up again from; anything later is gone. */
+  memcpy( m_latest, m_image, m_records[l_slot].image );
+  m_latest_size = m_records[l_slot].image;
+  m_count = p_record + 1;
+  m_write = m_records[l_slot].offset + m_records[l_slot].length;
+  m_since_key = p_record - l_key;
+  return true;
+}
+
+
+/* Functions. */
+
+/*
+ * snapshot_reset - forgets all the history; called at the start of a game.
+ */
+
+void snapshot_reset( void )
+{
+  m_first = m_count = m_write = m_since_key = 0;
+  m_latest_size = 0;
+}
+
+
+/*
+ * snapshot_record - takes a snapshot of the current tick, and adds it to the
+ *                   history.
+ */
+
+void snapshot_record( void )
+{
+  uint16_t  l_size, l_length, l_slot;
+  bool      l_key;
+  TRACE_SCOPE( "snapshot_record" );
+
+  l_size = game_save( m_image );
+
+  /* A keyframe if it's been a while, or the image has changed shape. */
+  l_key = ( m_count == 0 ) || ( m_since_key >= SNAPSHOT_KEY_EVERY ) || ( l_size != m_latest_size );
+  l_length = _snapshot_encode( m_image, l_key ? NULL : m_latest, l_size, NULL );
+  _snapshot_make_room( l_length );
+
+  /* If that cost us the keyframe we were going to build on, start afresh. */
+  if ( ( !l_key ) && ( m_count == 0 ) )
+  {
+    l_key = true;
+    l_length = _snapshot_encode( m_image, NULL, l_size, NULL );
+    _snapshot_make_room( l_length );
+  }
+
+  l_slot = ( m_first + m_count ) % SNAPSHOT_RECORDS;
+  _snapshot_encode( m_image, l_key ? NULL : m_latest, l_size, &m_ring[m_write] );
+  m_records[l_slot].offset = m_write;
+  m_records[l_slot].length = l_length;
+  m_records[l_slot].image = l_size;
+  m_records[l_slot].key = l_key;
+  m_count++;
+  m_write += l_length;
+  m_since_key = l_key ? 0 : m_since_key + 1;
+
+  memcpy( m_latest, m_image, l_size );
+  m_latest_size = l_size;
+}
+
+
+/*
+ * snapshot_rewind - winds the game back a number of ticks; play carries on
+ *                   from there, so the ticks wound past are forgotten.
+ *
+ * uint16_t - how many ticks to go back; if there isn't that much history,
+ *            we go back as far as we can
+ *
+ * Returns bool, true if the game was wound back.
+ */
+
+bool snapshot_rewind( uint16_t p_ticks )
+{
+  TRACE_SCOPE( "snapshot_rewind" );
+
+  if ( m_count == 0 )
+  {
+    return false;
+  }
+  return _snapshot_apply( ( p_ticks >= m_count ) ? 0 : m_count - 1 - p_ticks );
+}
+
+
+/*
+ * snapshot_ticks - returns how many ticks of history we're holding.
+ */
+
+uint16_t snapshot_ticks( void )
+{
+  return m_count;
+}
+
+
+/*
+ * snapshot_save - writes the latest snapshot out to storage, so that the game
+ *                 can be picked up again later.
+ *
+ * Returns bool, true if it was written.
+ */
+
+bool snapshot_save( void )
+{
+  uint32_t  l_header[SNAPSHOT_HEADER / 4];
+
+  if ( m_latest_size == 0 )
+  {
+    return false;
+  }
+
+  /* The image first, then the header; if we're cut off half way, the */
+  /* CRC won't match and the save is simply ignored.                  */
+  l_header[0] = SNAPSHOT_MAGIC;
+  l_header[1] = m_latest_size;
+  l_header[2] = storage_crc( m_latest, m_latest_size );
+  if ( !storage_write( STORAGE_SNAPSHOT + SNAPSHOT_HEADER, m_latest, m_latest_size ) )
+  {
+    return false;
+  }
+  return storage_write( STORAGE_SNAPSHOT, (const uint8_t *)l_header, SNAPSHOT_HEADER );
+}
+
+
+/*
+ * snapshot_load - restores the game from the snapshot in storage, if there
+ *                 is a good one. History starts again from there.
+ *
+ * Returns bool, true if the game was restored.
+ */
+
+bool snapshot_load( void )
+{
+  uint32_t  l_header[SNAPSHOT_HEADER / 4];
+
+  if ( !storage_read( STORAGE_SNAPSHOT, (uint8_t *)l_header, SNAPSHOT_HEADER ) )
+  {
+    return false;
+  }
+  if ( ( l_header[0] != SNAPSHOT_MAGIC ) || ( l_header[1] == 0 ) || ( l_header[1] > SNAPSHOT_IMAGE_SIZE ) ||
+       ( !storage_read( STORAGE_SNAPSHOT + SNAPSHOT_HEADER, m_image, l_header[1] ) ) ||
+       ( l_header[2] != storage_crc( m_image, l_header[1] ) ) )
+  {
+    return false;
+  }
+
+  if ( !game_restore( m_image, l_header[1] ) )
+  {
+    return false;
+  }
+  snapshot_reset();
+  snapshot_record();
+  return true;
+}
+
+
+/*
+ * snapshot_discard - marks the snapshot in storage as used up, so that a
+ *                    finished game isn't picked up again.
+ */
+
+void snapshot_discard( void )
+{
+  uint32_t l_header[SNAPSHOT_HEADER / 4];
+
+  memset( l_header, 0, SNAPSHOT_HEADER );
+  storage_write( STORAGE_SNAPSHOT, (const uint8_t *)l_header, SNAPSHOT_HEADER );
+}
+
+
+
+/*
+ * snapshot_put_32 - writes a 32 bit value into an image, low byte first, so
+ *                   that an image reads the same whatever wrote it.
+ *
+ * uint8_t * - where to write it
+ * uint32_t  - the value to write
+ *
+ * Returns the number of bytes written.
+ */
+
+uint16_t snapshot_put_32( uint8_t *p_image, uint32_t p_value )
+{
+  p_image[0] = p_value & 0xff;
+  p_image[1] = ( p_value >> 8 ) & 0xff;
+  p_image[2] = ( p_value >> 16 ) & 0xff;
+  p_image[3] = ( p_value >> 24 ) & 0xff;
+  return 4;
+}
+
+
+/*
+ * snapshot_get_32 - reads back a value written by snapshot_put_32.
+ *
+ * const uint8_t * - where to read it from
+ *
+ * Returns the value.
+ */
+
+uint32_t snapshot_get_32( const uint8_t *p_image )
+{
+  return (uint32_t)p_image[0] | ( (uint32_t)p_image[1] << 8 ) |
+         ( (uint32_t)p_image[2] << 16 ) | ( (uint32_t)p_image[3] << 24 );
+}
+
+
+/*
+ * snapshot_put_16 - writes a 16 bit value into an image, low byte first.
+ *
+ * uint8_t * - where to write it
+ * uint16_t  - the value to write
+ *
+ * Returns the number of bytes written.
+ */
+
+uint16_t snapshot_put_16( uint8_t *p_image, uint16_t p_value )
+{
+  p_image[0] = p_value & 0xff;
+  p_image[1] = ( p_value >> 8 ) & 0xff;
+  return 2;
+}
+
+
+/*
+ * snapshot_get_16 - reads back a value written by snapshot_put_16.
+ *
+ * const uint8_t * - where to read it from
+ *
+ * Returns the value.
+ */
+
+uint16_t snapshot_get_16( const uint8_t *p_image )
+{
+  return (uint16_t)( p_image[0] | ( p_image[1] << 8 ) );
+}
+
+/* End of snapshot.cpp */
@@ -30,58 +30,103 @@
 
 /* Module variables. */
 
-static rgba         m_text_colour;
-static uint16_t     m_gradient_row;
-static blit::timer  m_flicker_timer;
+static bee_font_t   m_outline_font;
+static rgba        *m_gradient;
+static bool         m_backdrop;
+static uint32_t     m_generation;
+static bool         m_redraw;
 
 
 /* Module functions. */
 
 /*
- * _splash_flicker_timer_update - callback for the font flicker and background
+ * _splash_decorate - draws everything on the screen which never moves.
  */
 
-void _splash_flicker_timer_update( blit::timer &p_timer )
+static void _splash_decorate( void )
 {
-  static uint16_t ls_loopcount = 0;
+  /* Frame everything with bricks; we're a brick game after all! */
+  sprite_render( "brick_yellow", 0, 0 );
+  sprite_render( "brick_yellow", 16, 0 );
+  sprite_render( "brick_yellow", 0, 8 );
+
+  sprite_render( "brick_yellow", 128, 0 );
+  sprite_render( "brick_yellow", 144, 0 );
+  sprite_render( "brick_yellow", 144, 8 );
+  
+  sprite_render( "brick_yellow", 0, 112 );
+  sprite_render( "brick_yellow", 16, 112 );
+  sprite_render( "brick_yellow", 0, 104 );
+
+  sprite_render( "brick_yellow", 128, 112 );
+  sprite_render( "brick_yellow", 144, 112 );
+  sprite_render( "brick_yellow", 144, 104 );
   
-  /* Update the text colour used for flickeringness. */
-  if ( ( ls_loopcount += 25 ) > 1200 ) 
+  /* Drop in the main logo nice and central(ish). */
+  sprite_render( "logo", -1, 15 );
+}
+
+
+/* Functions. */
+
+/*
+ * splash_enter - called when the splash screen is shown, to set it up.
+ */
+
+void splash_enter( void )
+{
+  /* Get hold of the outline font in our new renderer. */
+  memcpy( &m_outline_font, bee_text_create_fixed_font( outline_font ), sizeof( bee_font_t ) );
+  
+  /* The background gradient never changes shape, so work it out just once. */
+  m_gradient = effect_gradient_create();
+  
+  /* Nor does the frame, so draw it into an indexed backdrop if we can. */
+  m_backdrop = effect_backdrop_create( m_gradient );
+  if ( m_backdrop )
   {
-    ls_loopcount = 0;
+    sprite_target_indexed( true );
+    _splash_decorate();
+    sprite_target_indexed( false );
   }
-  m_text_colour = blit::rgba( 
-                              ls_loopcount % 255, 
-                              ( ls_loopcount % 512 ) / 2, 
-                              255 - ( ls_loopcount % 255 ),
-                              255
-                            );
-  m_gradient_row = ( ls_loopcount / 10 ) % 120;
+  
+  /* And start things flickering; the first frame always needs drawing. */
+  effect_flicker_start();
+  m_redraw = true;
 }
 
 
-/* Functions. */
+/*
+ * splash_exit - called when we leave the splash screen, to tidy up.
+ */
+
+void splash_exit( void )
+{
+  effect_flicker_stop();
+  m_gradient = NULL;
+  m_backdrop = false;
+  indexed_release();
+}
+
 
 /*
  * splash_update - cycle the state of the splash for animation purposes. 
  *
  * Returns gamestate_t, the state to continue in. Should either be SPLASH, 
- * or GAME when the user is ready to play.
+ * or GAME when the user (or the autoplayer) is ready to play.
  */
 
 gamestate_t splash_update( void )
 {
-  /* If it's not running, we need to set up the flicker timer. */
-  if ( !m_flicker_timer.started )
+  /* X lets the computer have a go instead. */
+  if ( blit::pressed( blit::button::X ) )
   {
-    m_flicker_timer.init( _splash_flicker_timer_update, 20, -1 );
-    m_flicker_timer.start();
+    autoplay_start();
   }
- 
+  
   /* Check to see if the player has pressed the start button. */
-  if ( blit::pressed( blit::button::A ) )
+  if ( ( blit::pressed( blit::button::A ) ) || ( autoplay_active() ) )
   {
-    m_flicker_timer.stop();
     return STATE_GAME;
   }
   
@@ -92,58 +137,46 @@ gamestate_t splash_update( void )
 
 /* 
  * splash_render - draw the current splash screen state onto the screen.
+ *
+ * Returns bool, true if anything was drawn.
  */
 
-void splash_render( void )
+bool splash_render( void )
 {
-  uint16_t    l_row;
   bee_point_t l_point;
-  bee_font_t  l_outline_font;
   
-  /* Clear the screen to a nice shifting gradient. */
-  for( l_row = 0; l_row < blit::fb.bounds.h; l_row++ )
+  /* If nothing has moved since last time, the screen is still good. */
+  if ( ( !m_redraw ) && ( m_generation == effect_generation() ) )
   {
-    blit::fb.pen( 
-      blit::rgba( 
-        (int)( 64.0f + 48.0f * ( sin( M_PI * 2 / blit::fb.bounds.h * l_row  ) ) ), 
-        0, 
-        (int)( 64.0f + 48.0f * ( cos( M_PI * 2 / blit::fb.bounds.h * l_row ) ) ), 
-        255 
-      )
-    );
-    blit::fb.line( point( 0, ( l_row + m_gradient_row ) % blit::fb.bounds.h ), 
-             point( blit::fb.bounds.w, ( l_row + m_gradient_row ) % blit::fb.bounds.h ) );
+    return false;
   }
+  m_redraw = false;
+  m_generation = effect_generation();
   
-  /* Frame everything with bricks; we're a brick game after all! */
-  sprite_render( "brick_yellow", 0, 0 );
-  sprite_render( "brick_yellow", 16, 0 );
-  sprite_render( "brick_yellow", 0, 8 );
-
-  sprite_render( "brick_yellow", 128, 0 );
-  sprite_render( "brick_yellow", 144, 0 );
-  sprite_render( "brick_yellow", 144, 8 );
-  
-  sprite_render( "brick_yellow", 0, 112 );
-  sprite_render( "brick_yellow", 16, 112 );
-  sprite_render( "brick_yellow", 0, 104 );
-
-  sprite_render( "brick_yellow", 128, 112 );
-  sprite_render( "brick_yellow", 144, 112 );
-  sprite_render( "brick_yellow", 144, 104 );
-  
-  /* Drop in the main logo nice and central(ish). */
-  sprite_render( "logo", -1, 15 );
+  /* The backdrop has the frame already on it, and scrolls by palette. */
+  if ( m_backdrop )
+  {
+    effect_backdrop_render();
+  }
+  else
+  {
+    effect_gradient_render( m_gradient );
+    _splash_decorate();
+  }
   
-  /* Get hold of the outline font in our new renderer. */
-  memcpy( &l_outline_font, bee_text_create_fixed_font( outline_font ), sizeof( bee_font_t ) );
-  bee_text_set_font( &l_outline_font );
+  /* Use the outline font we picked up on the way in. */
+  TRACE_BEGIN( "text" );
+  bee_text_set_font( &m_outline_font );
   
   /* Lastly, the text inviting the user to press the start button. */
-  blit::fb.pen( m_text_colour );
+  blit::fb.pen( effect_text_colour() );
   l_point.x = blit::fb.bounds.w / 2;
   l_point.y = 100;
   bee_text( &l_point, BEE_ALIGN_CENTRE, "PRESS 'A' TO START" );
+  l_point.y = 108;
+  bee_text( &l_point, BEE_ALIGN_CENTRE, "'X' TO WATCH" );
+  TRACE_END( "text" );
+  return true;
 }
 
 
@@ -0,0 +1,237 @@
+#!/usr/bin/env python3
+#
+# Sprite encoder; part of the asset builder. Reads the packed, paletted
+# sprites that sprite-builder has already written into assets.h, and works
+# out something cheaper for the game to draw each one from:
+#
+#  RAW    - straight RGBA pixels, for small sprites drawn every frame.
+#  RLE    - runs of RGBA colour, or of transparency, for big flat images.
+#  PACKED - the original data, if neither of the above is any smaller.
+#
+# Every sprite also gets a 1-bit collision mask, and the lot is tied together
+# in a metadata table which replaces the old name lookup.
+#
+# The cols and rows in the packed header count the 8 pixel tiles that
+# sprite-builder cut the image into, and those tiles are the frames of the
+# sheet; an image that doesn't divide evenly into them is a single frame.
+# For RAW sheets we also work out where each frame starts, so that drawing
+# one is just a table lookup.
+#
+# It also builds the brick type table from assets/bricks.txt, taking the
+# colour of the debris each brick sheds from its sprite.
+#
+# Usage: sprite-encoder.py assets.h >> assets.h
+#        sprite-encoder.py --bricks assets/bricks.txt assets.h > bricks.h
+
+import collections
+import re
+import sys
+
+# Sprites up to this many RAW bytes are always left raw; speed over size.
+RAW_LIMIT = 512
+
+# Longest run an RLE span can describe.
+RLE_MAX_RUN = 127
+
+
+def parse_sprites( p_source ):
+  """Pulls each packed sprite array out of the generated header."""
+  l_sprites = []
+  for l_match in re.finditer( r'uint8_t m_sprite_(\w+)\[\] = \{(.*?)\};', p_source, re.S ):
+    if not l_match.group( 2 ).lstrip().startswith( '0x53, 0x50, 0x52, 0x49, 0x54, 0x45, 0x50, 0x4b' ):
+      continue
+    l_body = re.sub( r'//[^\n]*', '', l_match.group( 2 ) )
+    l_bytes = bytes( int( l_byte, 16 ) for l_byte in re.findall( r'0x[0-9a-fA-F]+', l_body ) )
+    l_sprites.append( ( l_match.group( 1 ), l_bytes ) )
+  return l_sprites
+
+
+def decode_packed( p_data ):
+  """Unpacks a spritepk image into its dimensions, bit depth and RGBA pixels."""
+  l_width = p_data[10] | ( p_data[11] << 8 )
+  l_height = p_data[12] | ( p_data[13] << 8 )
+  l_colours = p_data[19] or 256
+  l_bitdepth = max( 1, ( l_colours - 1 ).bit_length() )
+
+  l_palette = []
+  l_offset = 20
+  for l_index in range( l_colours ):
+    l_palette.append( tuple( p_data[l_offset:l_offset + 4] ) )
+    l_offset += 4
+
+  l_pixels = []
+  l_value = l_bits = 0
+  for l_byte in p_data[l_offset:]:
+    for l_shift in range( 7, -1, -1 ):
+      l_value = ( l_value << 1 ) | ( ( l_byte >> l_shift ) & 1 )
+      l_bits += 1
+      if l_bits == l_bitdepth:
+        l_pixels.append( l_palette[l_value] if l_value < l_colours else ( 0, 0, 0, 0 ) )
+        l_value = l_bits = 0
+  return l_width, l_height, l_bitdepth, l_pixels[:l_width * l_height]
+
+
+def sheet_layout( p_width, p_height, p_data ):
+  """Returns the cols and rows of frames in the sheet; never less than one."""
+  l_cols = max( 1, p_data[14] | ( p_data[15] << 8 ) )
+  l_rows = max( 1, p_data[16] | ( p_data[17] << 8 ) )
+  if p_width % l_cols or p_height % l_rows:
+    return 1, 1
+  return l_cols, l_rows
+
+
+def encode_raw( p_pixels ):
+  """Native RGBA, four bytes a pixel, laid out exactly like blit::rgba."""
+  return bytes( l_channel for l_pixel in p_pixels for l_channel in l_pixel )
+
+
+def encode_rle( p_width, p_height, p_pixels ):
+  """Spans within each row; a count byte with the top bit set skips that many
+     clear pixels, otherwise it's followed by the RGBA to fill them with."""
+  l_output = bytearray()
+  for l_row in range( p_height ):
+    l_line = p_pixels[l_row * p_width:( l_row + 1 ) * p_width]
+    l_column = 0
+    while l_column < p_width:
+      l_start = l_column
+      l_pixel = l_line[l_column]
+      while ( l_column < p_width and l_column - l_start < RLE_MAX_RUN and
+              ( l_line[l_column] == l_pixel or ( l_pixel[3] == 0 and l_line[l_column][3] == 0 ) ) ):
+        l_column += 1
+      if l_pixel[3] == 0:
+        l_output.append( 0x80 | ( l_column - l_start ) )
+      else:
+        l_output.append( l_column - l_start )
+        l_output.extend( l_pixel )
+  return bytes( l_output )
+
+
+def encode_mask( p_width, p_height, p_pixels ):
+  """One bit per pixel, set where there's anything to hit; each row is
+     padded out to a whole byte."""
+  l_output = bytearray()
+  for l_row in range( p_height ):
+    l_byte = 0
+    for l_column in range( p_width ):
+      if p_pixels[l_row * p_width + l_column][3] != 0:
+        l_byte |= 0x80 >> ( l_column % 8 )
+      if l_column % 8 == 7 or l_column == p_width - 1:
+        l_output.append( l_byte )
+        l_byte = 0
+  return bytes( l_output )
+
+
+def frame_offsets( p_width, p_height, p_cols, p_rows ):
+  """Byte offsets of the top left of each frame in RAW pixel data."""
+  l_frame_width, l_frame_height = p_width // p_cols, p_height // p_rows
+  return [ ( ( l_row * l_frame_height * p_width ) + ( l_col * l_frame_width ) ) * 4
+           for l_row in range( p_rows ) for l_col in range( p_cols ) ]
+
+
+def emit_array( p_name, p_data ):
+  """Writes out a byte array in the same layout as sprite-builder."""
+  print( 'static constexpr' )
+  print( 'uint8_t %s[] = {' % p_name )
+  for l_offset in range( 0, len( p_data ), 16 ):
+    print( '    ' + ', '.join( '0x%02x' % l_byte for l_byte in p_data[l_offset:l_offset + 16] ) +
+           ( ',' if l_offset + 16 < len( p_data ) else '' ) )
+  print( '};' )
+  print()
+
+
+def debris_colour( p_pixels ):
+  """The commonest solid colour in a sprite, which is what it looks like
+     once it's been smashed into little bits."""
+  l_counts = collections.Counter( l_pixel[:3] for l_pixel in p_pixels if l_pixel[3] != 0 )
+  return l_counts.most_common( 1 )[0][0] if l_counts else ( 0, 0, 0 )
+
+
+def emit_bricks( p_sprites, p_definitions ):
+  """Writes out the brick type table, one entry per line of definitions."""
+  l_colours = { l_name: debris_colour( decode_packed( l_data )[3] ) for l_name, l_data in p_sprites }
+  l_entries = [ '  { NULL, 0, 0, { 0, 0, 0 } },' ]
+  for l_line in p_definitions.splitlines():
+    l_fields = l_line.split( '#' )[0].split()
+    if not l_fields:
+      continue
+    l_sprite, l_score, l_flags = l_fields[0], int( l_fields[1] ), l_fields[2:]
+    if l_sprite not in l_colours:
+      sys.exit( 'brick sprite %s not found' % l_sprite )
+    l_entries.append( '  { "%s", %d, %s, { %d, %d, %d } },' %
+                      ( ( l_sprite, l_score,
+                          ' | '.join( 'BRICK_FLAG_' + l_flag for l_flag in l_flags ) or '0' ) +
+                        l_colours[l_sprite] ) )
+
+  print( '/*' )
+  print( ' * bricks.h - this is an auto-generated asset file. Please do not edit!' )
+  print( ' */' )
+  print()
+  print( 'static const struct {' )
+  print( '  const char *sprite;' )
+  print( '  uint8_t     score;' )
+  print( '  uint8_t     flags;' )
+  print( '  uint8_t     debris[3];                      /* RGB of the bits it sheds. */' )
+  print( '} m_brickdefs[BRICK_TYPES] =' )
+  print( '{' )
+  print( '\n'.join( l_entries ).rstrip( ',' ) )
+  print( '};' )
+
+
+def main():
+  if sys.argv[1] == '--bricks':
+    with open( sys.argv[2] ) as l_file:
+      l_definitions = l_file.read()
+    with open( sys.argv[3] ) as l_file:
+      emit_bricks( parse_sprites( l_file.read() ), l_definitions )
+    return
+
+  with open( sys.argv[1] ) as l_file:
+    l_sprites = parse_sprites( l_file.read() )
+
+  l_table = []
+  for l_name, l_data in l_sprites:
+    l_width, l_height, l_bitdepth, l_pixels = decode_packed( l_data )
+
+    # Pick the encoding; small sprites raw, big ones RLE if it's any good.
+    l_raw = encode_raw( l_pixels )
+    l_rle = encode_rle( l_width, l_height, l_pixels )
+    if len( l_raw ) <= RAW_LIMIT:
+      l_encoding, l_pixeldata = 'SPRITE_RAW', l_raw
+    elif len( l_rle ) < len( l_data ):
+      l_encoding, l_pixeldata = 'SPRITE_RLE', l_rle
+    else:
+      l_encoding, l_pixeldata = 'SPRITE_PACKED', None
+
+    print( '/* %s: %dx%d, %d bpp packed, %s (%d bytes) */' %
+           ( l_name, l_width, l_height, l_bitdepth, l_encoding,
+             len( l_pixeldata ) if l_pixeldata else len( l_data ) ) )
+    if l_pixeldata:
+      emit_array( 'm_sprite_%s_pixels' % l_name, l_pixeldata )
+    emit_array( 'm_sprite_%s_mask' % l_name, encode_mask( l_width, l_height, l_pixels ) )
+
+    # Sheets with more than one frame in them get their frame offsets too.
+    l_cols, l_rows = sheet_layout( l_width, l_height, l_data )
+    l_frames = 'NULL'
+    if l_encoding == 'SPRITE_RAW' and l_cols * l_rows > 1:
+      l_frames = 'm_sprite_%s_frames' % l_name
+      print( 'static constexpr' )
+      print( 'uint32_t %s[] = { %s };' %
+             ( l_frames, ', '.join( str( l_offset ) for l_offset in
+                                    frame_offsets( l_width, l_height, l_cols, l_rows ) ) ) )
+      print()
+
+    l_table.append( '{ "%s", %d, %d, %d, %d, %d, %d, %d, %s, m_sprite_%s, %s, m_sprite_%s_mask, %s },' %
+                    ( l_name, l_width, l_height, l_bitdepth, l_data[19] or 256, len( l_data ),
+                      l_cols, l_rows, l_encoding, l_name,
+                      ( 'm_sprite_%s_pixels' % l_name ) if l_pixeldata else 'NULL', l_name, l_frames ) )
+
+  # And the metadata table that sprite.cpp looks everything up in; it's all
+  # constant, so the compiler can resolve lookups into it for us.
+  print( 'static constexpr spritemeta_t m_sprites[] = {' )
+  for l_entry in l_table:
+    print( l_entry )
+  print( '{ NULL, 0, 0, 0, 0, 0, 0, 0, SPRITE_PACKED, NULL, NULL, NULL, NULL }};' )
+
+
+if __name__ == '__main__':
+  main()
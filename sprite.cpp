@@ -7,6 +7,10 @@
  * but as separate entities rather than a monolithic sprite sheet as there are
  * so few of them, and they're all different sizes.
  *
+ * The asset builder also re-encodes each sprite into whichever of raw RGBA or
+ * RLE spans is cheapest to draw, and describes it all in a metadata table, so
+ * mostly we don't need to unpack anything at runtime.
+ *
  * Please note that this is a first attempt at understanding a somewhat fluid
  * API on a shiny new bit of kit, so it probably is not full of 'best practice'.
  * It will hopefully serve as some sort of starting point, however.
@@ -29,42 +33,363 @@
 #include "32blox.hpp"
 
 
+/* Constants. */
+
+#define SPRITE_CACHE_SLOTS  8
+#define SPRITE_COUNT        ( ( sizeof( m_sprites ) / sizeof( m_sprites[0] ) ) - 1 )
+
+
 /* Module variables. */
 
 /* Raw sprite data. */
 
 #include "assets.h"
 
+static bool m_indexed;                    /* Drawing into the indexed target? */
+
+/* Decoded frames of sheets that aren't stored raw; lives in the arena. */
+/* Every slot is big enough for the largest such frame, so once one has */
+/* been allocated it's simply reused until the arena is reset.          */
+static struct {
+  uint8_t   sprite;
+  uint16_t  frame;
+  uint8_t  *pixels;
+}           m_cache[SPRITE_CACHE_SLOTS];
+static uint8_t  m_cache_next;
+
 
 /* Module functions. */
 
+/*
+ * _sprite_match - compares two sprite names; a constexpr strcmp, basically.
+ *
+ * const char * - the first name
+ * const char * - the second name
+ *
+ * Returns bool, true if the names are the same.
+ */
+
+static constexpr bool _sprite_match( const char *p_first, const char *p_second )
+{
+  while( ( *p_first != '\0' ) && ( *p_first == *p_second ) )
+  {
+    p_first++;
+    p_second++;
+  }
+  return ( *p_first == *p_second );
+}
+
+
+/*
+ * _sprite_find - looks up the named sprite in the metadata table. This can
+ *                be done at compile time, if the name is known then.
+ *
+ * const char * - the name of the sprite
+ *
+ * Returns the sprite's metadata, or NULL if there is no such sprite.
+ */
+
+static constexpr const spritemeta_t *_sprite_find( const char *p_sprite )
+{
+  uint8_t l_index = 0;
+
+  for( l_index = 0; m_sprites[l_index].name != NULL; l_index++ )
+  {
+    if ( _sprite_match( p_sprite, m_sprites[l_index].name ) )
+    {
+      return &m_sprites[l_index];
+    }
+  }
+  return NULL;
+}
+
+
+/* The ball and bat are drawn every frame, so make sure they stay cheap. */
+
+static_assert( _sprite_find( "ball" )->encoding == SPRITE_RAW, "ball should be pre-decoded" );
+static_assert( _sprite_find( "bat_normal" )->encoding == SPRITE_RAW, "bat should be pre-decoded" );
+
+
+/*
+ * _sprite_span - draws a run of pixels in a single colour, into whichever
+ *                target we're currently pointed at.
+ *
+ * int16_t  - the column to start from
+ * int16_t  - the row to draw on
+ * uint16_t - the number of pixels
+ * rgba     - the colour to draw in
+ */
+
+static void _sprite_span( int16_t p_column, int16_t p_row, uint16_t p_count, rgba p_colour )
+{
+  uint16_t l_index;
+
+  /* Indexed targets have no blending, so clear pixels are just skipped. */
+  if ( m_indexed )
+  {
+    if ( p_colour.a == 0 )
+    {
+      return;
+    }
+    l_index = indexed_add_colour( p_colour );
+    if ( l_index == INDEXED_FULL )
+    {
+      return;
+    }
+    while( p_count-- > 0 )
+    {
+      indexed_plot( p_column++, p_row, l_index );
+    }
+    return;
+  }
+
+  blit::fb.pen( p_colour );
+  while( p_count-- > 0 )
+  {
+    blit::fb.pixel( point( p_column++, p_row ) );
+  }
+}
+
+
+/*
+ * _sprite_blit - draws a block of RGBA pixels, skipping the clear ones.
+ *
+ * const uint8_t * - the top left pixel of the block
+ * uint16_t        - the stride between rows, in bytes
+ * uint16_t        - the width of the block
+ * uint16_t        - the height of the block
+ * int16_t         - the column to draw at
+ * int16_t         - the row to draw at
+ */
+
+static void _sprite_blit( const uint8_t *p_pixels, uint16_t p_stride, uint16_t p_width,
+                          uint16_t p_height, int16_t p_column, int16_t p_row )
+{
+  const uint8_t *l_pixel;
+  uint16_t       l_row, l_column;
+
+  for ( l_row = 0; l_row < p_height; l_row++ )
+  {
+    l_pixel = p_pixels + ( l_row * p_stride );
+    for ( l_column = 0; l_column < p_width; l_column++ )
+    {
+      if ( l_pixel[3] != 0 )
+      {
+        _sprite_span( p_column + l_column, p_row + l_row, 1,
+                      rgba( l_pixel[0], l_pixel[1], l_pixel[2], l_pixel[3] ) );
+      }
+      l_pixel += 4;
+    }
+  }
+}
+
+
+/*
+ * _sprite_decode - unpacks a rectangle of an RLE or packed sprite into RGBA
+ *                  pixels; anything not covered is left clear.
+ *
+ * const spritemeta_t * - the sprite to decode
+ * uint16_t             - the left column of the rectangle
+ * uint16_t             - the top row of the rectangle
+ * uint16_t             - the width of the rectangle
+ * uint16_t             - the height of the rectangle
+ * uint8_t *            - where to put the pixels, width * height * 4 bytes
+ */
+
+static void _sprite_decode( const spritemeta_t *p_meta, uint16_t p_left, uint16_t p_top,
+                            uint16_t p_width, uint16_t p_height, uint8_t *p_output )
+{
+  const uint8_t *l_data, *l_end, *l_palette;
+  uint16_t       l_row, l_column, l_index;
+  uint8_t        l_count, l_bit, l_pixel;
+
+  memset( p_output, 0, p_width * p_height * 4 );
+
+  if ( p_meta->encoding == SPRITE_RLE )
+  {
+    l_data = p_meta->pixels;
+    for ( l_row = 0; l_row < p_top + p_height; l_row++ )
+    {
+      for ( l_column = 0; l_column < p_meta->width; l_column += l_count )
+      {
+        /* Clear spans need nothing doing, just skipping. */
+        l_count = *l_data++;
+        if ( l_count & 0x80 )
+        {
+          l_count &= 0x7f;
+          continue;
+        }
+
+        /* Otherwise, copy out whatever part of the span falls inside. */
+        if ( l_row >= p_top )
+        {
+          for ( l_index = l_column; l_index < l_column + l_count; l_index++ )
+          {
+            if ( ( l_index >= p_left ) && ( l_index < p_left + p_width ) )
+            {
+              memcpy( &p_output[ ( ( ( l_row - p_top ) * p_width ) + ( l_index - p_left ) ) * 4 ],
+                      l_data, 4 );
+            }
+          }
+        }
+        l_data += 4;
+      }
+    }
+    return;
+  }
+
+  /* Packed data is a palette, then a stream of indices into it. */
+  l_palette = p_meta->packed + sizeof(packed_image);
+  l_data = l_palette + ( p_meta->palette_count * 4 );
+  l_end = p_meta->packed + p_meta->packed_length;
+  l_row = l_column = l_bit = l_pixel = 0;
+  for ( ; ( l_data < l_end ) && ( l_row < p_top + p_height ); l_data++ )
+  {
+    for ( l_index = 0; l_index < 8; l_index++ )
+    {
+      l_pixel = ( l_pixel << 1 ) | ( ( ( 0b10000000 >> l_index ) & *l_data ) ? 1 : 0 );
+      if ( ++l_bit == p_meta->bitdepth )
+      {
+        if ( ( l_row >= p_top ) && ( l_column >= p_left ) && ( l_column < p_left + p_width ) )
+        {
+          memcpy( &p_output[ ( ( ( l_row - p_top ) * p_width ) + ( l_column - p_left ) ) * 4 ],
+                  &l_palette[ l_pixel * 4 ], 4 );
+        }
+        if ( ++l_column >= p_meta->width )
+        {
+          l_column = 0;
+          l_row++;
+        }
+        l_bit = l_pixel = 0;
+      }
+    }
+  }
+}
+
+
+/*
+ * _sprite_cache_slot_size - works out how big a cache slot needs to be, to
+ *                           hold any frame of any sheet that isn't raw.
+ *
+ * Returns the size of the largest such frame, in bytes.
+ */
+
+static uint32_t _sprite_cache_slot_size( void )
+{
+  uint8_t   l_sprite;
+  uint32_t  l_size, l_largest = 0;
+
+  for ( l_sprite = 0; m_sprites[l_sprite].name != NULL; l_sprite++ )
+  {
+    if ( ( m_sprites[l_sprite].encoding == SPRITE_RAW ) ||
+         ( m_sprites[l_sprite].cols * m_sprites[l_sprite].rows < 2 ) )
+    {
+      continue;
+    }
+    l_size = ( m_sprites[l_sprite].width / m_sprites[l_sprite].cols ) *
+             ( m_sprites[l_sprite].height / m_sprites[l_sprite].rows ) * 4;
+    if ( l_size > l_largest )
+    {
+      l_largest = l_size;
+    }
+  }
+  return l_largest;
+}
+
+
+/*
+ * _sprite_cached_frame - finds a decoded copy of a frame, decoding it into
+ *                        the cache if it isn't already there.
+ *
+ * uint8_t  - the sprite ID
+ * uint16_t - the frame within the sheet
+ *
+ * Returns the RGBA pixels of the frame, or NULL if there's no room.
+ */
+
+static const uint8_t *_sprite_cached_frame( uint8_t p_sprite, uint16_t p_frame )
+{
+  const spritemeta_t *l_meta = &m_sprites[p_sprite];
+  uint16_t            l_width, l_height;
+  uint8_t             l_slot;
+
+  /* Hopefully, we've seen it before. */
+  for ( l_slot = 0; l_slot < SPRITE_CACHE_SLOTS; l_slot++ )
+  {
+    if ( ( m_cache[l_slot].pixels != NULL ) && ( m_cache[l_slot].sprite == p_sprite ) &&
+         ( m_cache[l_slot].frame == p_frame ) )
+    {
+      return m_cache[l_slot].pixels;
+    }
+  }
+
+  /* If not, take the next slot in turn; it only needs allocating once. */
+  l_width = l_meta->width / l_meta->cols;
+  l_height = l_meta->height / l_meta->rows;
+  l_slot = m_cache_next;
+  m_cache_next = ( m_cache_next + 1 ) % SPRITE_CACHE_SLOTS;
+  if ( m_cache[l_slot].pixels == NULL )
+  {
+    m_cache[l_slot].pixels = (uint8_t *)arena_alloc( _sprite_cache_slot_size() );
+    if ( m_cache[l_slot].pixels == NULL )
+    {
+      return NULL;
+    }
+  }
+
+  m_cache[l_slot].sprite = p_sprite;
+  m_cache[l_slot].frame = p_frame;
+  _sprite_decode( l_meta, ( p_frame % l_meta->cols ) * l_width, ( p_frame / l_meta->cols ) * l_height,
+                  l_width, l_height, m_cache[l_slot].pixels );
+  return m_cache[l_slot].pixels;
+}
+
+
+/*
+ * _sprite_solid - checks a sprite's collision mask for a single pixel.
+ *
+ * const spritemeta_t * - the sprite's metadata
+ * int32_t              - the column within the sprite
+ * int32_t              - the row within the sprite
+ *
+ * Returns true if there's something there to hit.
+ */
+
+static bool _sprite_solid( const spritemeta_t *p_meta, int32_t p_column, int32_t p_row )
+{
+  uint16_t l_stride = ( p_meta->width + 7 ) / 8;
+
+  return ( p_meta->mask[ ( p_row * l_stride ) + ( p_column / 8 ) ] & ( 0b10000000 >> ( p_column % 8 ) ) ) != 0;
+}
+
+
 /*
  * m_align_x - applies the alignment adjustment in the X axis
  * 
  * int16_t, the initial x position
- * const packed_image *, the sprite data
+ * uint16_t, the width of the sprite
  * spritealign_t, the alignment factor
  * 
  * Returns the adjusted x value
  */
 
-static int16_t m_align_x( int16_t p_x, const packed_image *p_sprite, spritealign_t p_align )
+static int16_t m_align_x( int16_t p_x, uint16_t p_width, spritealign_t p_align )
 {
   /* Only have options here where adjustments are needed. */
   switch( p_align )
   {
     case ALIGN_TOPCENTRE:
-      return( p_x - ( p_sprite->width / 2 ) );
+      return( p_x - ( p_width / 2 ) );
     case ALIGN_TOPRIGHT:
-      return( p_x - p_sprite->width );
+      return( p_x - p_width );
     case ALIGN_MIDCENTRE:
-      return( p_x - ( p_sprite->width / 2 ) );
+      return( p_x - ( p_width / 2 ) );
     case ALIGN_MIDRIGHT:
-      return( p_x - p_sprite->width );
+      return( p_x - p_width );
     case ALIGN_BOTCENTRE:
-      return( p_x - ( p_sprite->width / 2 ) );
+      return( p_x - ( p_width / 2 ) );
     case ALIGN_BOTRIGHT:
-      return( p_x - p_sprite->width );
+      return( p_x - p_width );
   }
   
   /* Default to applying no adjustments. */
@@ -76,29 +401,29 @@ static int16_t m_align_x( int16_t p_x, const packed_image *p_sprite, spritealign
  * m_align_y - applies the alignment adjustment in the Y axis
  * 
  * int16_t, the initial y position
- * const packed_image *, the sprite data
+ * uint16_t, the height of the sprite
  * spritealign_t, the alignment factor
  * 
  * Returns the adjusted y value
  */
 
-static int16_t m_align_y( int16_t p_y, const packed_image *p_sprite, spritealign_t p_align )
+static int16_t m_align_y( int16_t p_y, uint16_t p_height, spritealign_t p_align )
 {
   /* Only have options here where adjustments are needed. */
   switch( p_align )
   {
     case ALIGN_MIDLEFT:
-      return( p_y - ( p_sprite->height / 2 ) );
+      return( p_y - ( p_height / 2 ) );
     case ALIGN_MIDCENTRE:
-      return( p_y - ( p_sprite->height / 2 ) );
+      return( p_y - ( p_height / 2 ) );
     case ALIGN_MIDRIGHT:
-      return( p_y - ( p_sprite->height / 2 ) );
+      return( p_y - ( p_height / 2 ) );
     case ALIGN_BOTLEFT:
-      return( p_y - p_sprite->height );
+      return( p_y - p_height );
     case ALIGN_BOTCENTRE:
-      return( p_y - p_sprite->height );
+      return( p_y - p_height );
     case ALIGN_BOTRIGHT:
-      return( p_y - p_sprite->height );
+      return( p_y - p_height );
   }
   
   /* Default to applying no adjustments. */
@@ -122,54 +447,93 @@ using namespace blit;
 
 void sprite_render( const char *p_sprite, int16_t p_column, int16_t p_row, spritealign_t p_align )
 {
-  uint8_t             l_index;
+  sprite_render_id( sprite_id( p_sprite ), p_column, p_row, p_align );
+}
+
+
+/*
+ * sprite_render_id - as sprite_render, but for a sprite already looked up
+ *                    with sprite_id.
+ *
+ * uint8_t      - the sprite ID
+ * uint16_t     - column to start drawing from (x), or -1 to centre.
+ * uint16_t     - row to start drawing from (y), or -1 to centre.
+ * spritealign_t- defines the origin point of the render.
+ */
+
+void sprite_render_id( uint8_t p_sprite, int16_t p_column, int16_t p_row, spritealign_t p_align )
+{
+  uint16_t            l_index;
   rgba                l_palette[256];
-  const packed_image *l_sprite;
-  const uint8_t      *l_spritedata;
-  uint8_t             l_bitdepth, l_bit, l_pixel;
+  const spritemeta_t *l_meta;
+  const uint8_t      *l_spritedata, *l_end;
+  uint8_t             l_bit, l_pixel, l_count;
   uint16_t            l_row, l_column;
+  TRACE_SCOPE( "sprite_render" );
   
-  /* Step one, find the sprite in the lookup table. */
-  for( l_index = 0; m_sprites[l_index].name != NULL; l_index++ )
-  {
-    if ( strcmp( p_sprite, m_sprites[l_index].name ) == 0 )
-    {
-      break;
-    }
-  }
-
-  /* If we didn't find anything, we can't really proceed any further. */
-  if ( m_sprites[l_index].data == NULL )
+  /* Step one, make sure it's a sprite we know about. */
+  if ( p_sprite >= SPRITE_COUNT )
   {
     return;
   }
+  l_meta = &m_sprites[p_sprite];
 
-  /* Step two, extract some basic metrics about the chosen sprite. */
-  l_sprite = (const packed_image *)m_sprites[l_index].data;
-  l_spritedata = m_sprites[l_index].data + sizeof(packed_image);
-  l_bitdepth = ceil( log(l_sprite->palette_entry_count) / log(2) );
-  
-  /* Step three, if we're centering we finally have the data to do so! */
+  /* Step two, if we're centering we have the size to hand to do so. */
   if ( p_row == -1 )
   {
-    p_row = ( fb.bounds.h - l_sprite->height ) / 2;
+    p_row = ( fb.bounds.h - l_meta->height ) / 2;
   }
   if ( p_column == -1 )
   {
-    p_column = ( fb.bounds.w - l_sprite->width ) / 2;
+    p_column = ( fb.bounds.w - l_meta->width ) / 2;
   }
   
-  /* Step 3.5, apply any alignment requirements, as best we can. */
-  p_column = m_align_x( p_column, l_sprite, p_align );
-  p_row = m_align_y( p_row, l_sprite, p_align );
+  /* Step 2.5, apply any alignment requirements, as best we can. */
+  p_column = m_align_x( p_column, l_meta->width, p_align );
+  p_row = m_align_y( p_row, l_meta->height, p_align );
 
   if ( p_row < -1 ) p_row = 0;
   if ( p_row > fb.bounds.h ) p_row = fb.bounds.h;
   if ( p_column < -1 ) p_column = 0;
   if ( p_column > fb.bounds.w ) p_column = fb.bounds.w;
-  
-  /* Step four, extract the palette into a more useful form. */
-  for( l_index = 0; l_index < l_sprite->palette_entry_count; l_index++ )
+
+  /* Step three, draw it out in whatever form the asset builder left it. */
+  switch( l_meta->encoding )
+  {
+    case SPRITE_RAW:
+      /* Raw RGBA, a pixel at a time. */
+      _sprite_blit( l_meta->pixels, l_meta->width * 4, l_meta->width, l_meta->height,
+                    p_column, p_row );
+      return;
+
+    case SPRITE_RLE:
+      /* Spans of colour; the top bit of the count means a clear span. */
+      l_spritedata = l_meta->pixels;
+      for ( l_row = 0; l_row < l_meta->height; l_row++ )
+      {
+        for ( l_column = 0; l_column < l_meta->width; l_column += l_count )
+        {
+          l_count = *l_spritedata++;
+          if ( l_count & 0x80 )
+          {
+            l_count &= 0x7f;
+            continue;
+          }
+          _sprite_span( p_column + l_column, p_row + l_row, l_count,
+                        rgba( l_spritedata[0], l_spritedata[1], l_spritedata[2], l_spritedata[3] ) );
+          l_spritedata += 4;
+        }
+      }
+      return;
+
+    case SPRITE_PACKED:
+      break;
+  }
+
+  /* Otherwise, step four - extract the palette into a more useful form. */
+  l_spritedata = l_meta->packed + sizeof(packed_image);
+  l_end = l_meta->packed + l_meta->packed_length;
+  for( l_index = 0; l_index < l_meta->palette_count; l_index++ )
   {
     l_palette[l_index] = rgba( l_spritedata[ 0 ], l_spritedata[ 1 ], 
                                l_spritedata[ 2 ], l_spritedata[ 3 ] );
@@ -178,7 +542,7 @@ void sprite_render( const char *p_sprite, int16_t p_column, int16_t p_row, sprit
   
   /* And lastly, step five - extract the packed data, and spit it out. */
   l_row = l_column = l_bit = l_pixel = 0;
-  for ( ; l_spritedata < (const uint8_t *)l_sprite + l_sprite->byte_count; l_spritedata++ )
+  for ( ; l_spritedata < l_end; l_spritedata++ )
   {
     /* Extract each bit from each byte, up to the required bitdepth. */
     for ( l_index = 0; l_index < 8; l_index++ )
@@ -190,14 +554,13 @@ void sprite_render( const char *p_sprite, int16_t p_column, int16_t p_row, sprit
       l_pixel |= ( ( 0b10000000 >> l_index ) & *l_spritedata ) ? 1 : 0;
 
       /* And if we've fetched enough bits, spit out that pixel value. */
-      if ( ++l_bit == l_bitdepth )
+      if ( ++l_bit == l_meta->bitdepth )
       {
         /* Set the pixel at the current point. */
-        fb.pen( l_palette[l_pixel] );
-        fb.pixel( point( p_column + l_column, p_row + l_row ) );
+        _sprite_span( p_column + l_column, p_row + l_row, 1, l_palette[l_pixel] );
 
         /* And move along to the next column. */
-        if ( ++l_column >= l_sprite->width )
+        if ( ++l_column >= l_meta->width )
         {
           l_column = 0;
           l_row++;
@@ -209,6 +572,121 @@ void sprite_render( const char *p_sprite, int16_t p_column, int16_t p_row, sprit
 }
 
 
+/*
+ * sprite_id - looks up the ID of a sprite, so that it can be drawn without
+ *             searching for it by name every time.
+ *
+ * const char * - the name of the sprite
+ *
+ * Returns the sprite ID, or SPRITE_NONE if there is no such sprite.
+ */
+
+uint8_t sprite_id( const char *p_sprite )
+{
+  const spritemeta_t *l_meta = _sprite_find( p_sprite );
+
+  return ( l_meta == NULL ) ? SPRITE_NONE : ( l_meta - m_sprites );
+}
+
+
+/*
+ * sprite_frames - returns the number of frames in a sprite sheet. The frames
+ *                 are the 8 pixel tiles sprite-builder cut the image into;
+ *                 anything that doesn't tile evenly is a single frame.
+ *
+ * uint8_t - the sprite ID
+ *
+ * Returns the number of frames, or zero for an invalid ID.
+ */
+
+uint16_t sprite_frames( uint8_t p_sprite )
+{
+  if ( p_sprite >= SPRITE_COUNT )
+  {
+    return 0;
+  }
+  return m_sprites[p_sprite].cols * m_sprites[p_sprite].rows;
+}
+
+
+/*
+ * sprite_render_frame - draws a single frame out of a sprite sheet. Frames
+ *                       are numbered across and then down the sheet.
+ *
+ * uint8_t       - the sprite ID, from sprite_id
+ * uint16_t      - the frame to draw
+ * int16_t       - column to start drawing from (x)
+ * int16_t       - row to start drawing from (y)
+ * spritealign_t - defines the origin point of the render.
+ */
+
+void sprite_render_frame( uint8_t p_sprite, uint16_t p_frame, int16_t p_column,
+                          int16_t p_row, spritealign_t p_align )
+{
+  const spritemeta_t *l_meta;
+  const uint8_t      *l_pixels;
+  uint16_t            l_width, l_height;
+
+  if ( p_frame >= sprite_frames( p_sprite ) )
+  {
+    return;
+  }
+  l_meta = &m_sprites[p_sprite];
+  l_width = l_meta->width / l_meta->cols;
+  l_height = l_meta->height / l_meta->rows;
+
+  p_column = m_align_x( p_column, l_width, p_align );
+  p_row = m_align_y( p_row, l_height, p_align );
+
+  /* A sheet of one is just the sprite; no point caching a copy of it. */
+  if ( sprite_frames( p_sprite ) == 1 )
+  {
+    sprite_render_id( p_sprite, p_column, p_row );
+    return;
+  }
+
+  /* Raw sheets can be drawn straight out of flash. */
+  if ( l_meta->encoding == SPRITE_RAW )
+  {
+    l_pixels = l_meta->pixels + ( ( l_meta->frames != NULL ) ? l_meta->frames[p_frame] : 0 );
+    _sprite_blit( l_pixels, l_meta->width * 4, l_width, l_height, p_column, p_row );
+    return;
+  }
+
+  /* Anything else gets decoded once, and drawn from the cache after that. */
+  l_pixels = _sprite_cached_frame( p_sprite, p_frame );
+  if ( l_pixels != NULL )
+  {
+    _sprite_blit( l_pixels, l_width * 4, l_width, l_height, p_column, p_row );
+  }
+}
+
+
+/*
+ * sprite_cache_flush - forgets every cached frame; called by arena_reset,
+ *                      as that's where they live.
+ */
+
+void sprite_cache_flush( void )
+{
+  memset( m_cache, 0, sizeof( m_cache ) );
+  m_cache_next = 0;
+}
+
+
+/*
+ * sprite_target_indexed - directs sprite_render into the indexed target
+ *                         rather than the framebuffer, or back again.
+ *
+ * bool - true to draw into the indexed target
+ */
+
+void sprite_target_indexed( bool p_indexed )
+{
+  m_indexed = p_indexed;
+}
+
+
 /*
  * sprite_size - returns the size of the named sprite.
  * 
@@ -219,28 +697,15 @@ void sprite_render( const char *p_sprite, int16_t p_column, int16_t p_row, sprit
 
 size sprite_size( const char *p_sprite )
 {
-  uint8_t             l_index;
-  const packed_image *l_sprite;
+  const spritemeta_t *l_meta = _sprite_find( p_sprite );
   
-  /* Step one, find the sprite in the lookup table. */
-  for( l_index = 0; m_sprites[l_index].name != NULL; l_index++ )
-  {
-    if ( strcmp( p_sprite, m_sprites[l_index].name ) == 0 )
-    {
-      break;
-    }
-  }
-
   /* If we didn't find anything, we can't really proceed any further. */
-  if ( m_sprites[l_index].data == NULL )
+  if ( l_meta == NULL )
   {
     return size( 0, 0 );
   }
 
-  /* Step two, extract some basic metrics about the chosen sprite. */
-  l_sprite = (const packed_image *)m_sprites[l_index].data;  
-  
-  return size( l_sprite->width, l_sprite->height );
+  return size( l_meta->width, l_meta->height );
 }
 
 
@@ -261,59 +726,41 @@ size sprite_size( const char *p_sprite )
 bool sprite_collide( const char *pa_sprite, int16_t pa_column, int16_t pa_row, spritealign_t pa_align,
                      const char *pb_sprite, int16_t pb_column, int16_t pb_row, spritealign_t pb_align )
 {
-  uint8_t             l_index;
-  rgba                la_palette[256], lb_palette[256];
-  const packed_image *la_sprite = NULL, *lb_sprite = NULL;
-  const uint8_t      *la_spritedata, *lb_spritedata;
-  uint8_t             la_bitdepth, lb_bitdepth;
+  return sprite_collide_id( sprite_id( pa_sprite ), pa_column, pa_row, pa_align,
+                            sprite_id( pb_sprite ), pb_column, pb_row, pb_align );
+}
+
+
+/*
+ * sprite_collide_id - as sprite_collide, but for sprites already looked up
+ *                     with sprite_id.
+ */
+
+bool sprite_collide_id( uint8_t pa_sprite, int16_t pa_column, int16_t pa_row, spritealign_t pa_align,
+                        uint8_t pb_sprite, int16_t pb_column, int16_t pb_row, spritealign_t pb_align )
+{
+  const spritemeta_t *la_sprite, *lb_sprite;
   rect                la_bounds, lb_bounds;
-  uint8_t             l_bit, l_pixel;
-  uint16_t            l_row, l_column;
+  int32_t             l_left, l_right, l_top, l_bottom, l_x, l_y;
   
-  /* First off, we will need to have hold of both sprites */
-  for( l_index = 0; m_sprites[l_index].name != NULL; l_index++ )
-  {
-    /* Match the first sprite, unless we already found it. */
-    if ( ( la_sprite == NULL ) && ( strcmp( pa_sprite, m_sprites[l_index].name ) == 0 ) )
-    {
-      /* Extract the details, but carry on to match the second. */
-      la_sprite = (const packed_image *)m_sprites[l_index].data;
-      la_spritedata = m_sprites[l_index].data + sizeof(packed_image);
-      la_bitdepth = ceil( log(la_sprite->palette_entry_count) / log(2) );
-    }
-    
-    /* Do the same for the second sprite. */
-    if ( ( lb_sprite == NULL ) && ( strcmp( pb_sprite, m_sprites[l_index].name ) == 0 ) )
-    {
-      /* Extract the details, but carry on to match the second. */
-      lb_sprite = (const packed_image *)m_sprites[l_index].data;
-      lb_spritedata = m_sprites[l_index].data + sizeof(packed_image);
-      lb_bitdepth = ceil( log(lb_sprite->palette_entry_count) / log(2) );
-    }
-    
-    /* Now if we've found both sprites we can jump out early. */
-    if ( ( la_sprite != NULL ) && ( lb_sprite != NULL ) )
-    {
-      break;
-    }
-  }
-
-  /* If we didn't find anything, we can't really proceed any further. */
-  if ( ( la_sprite == NULL ) || ( lb_sprite == NULL ) )
+  /* If we don't know both sprites, we can't really proceed any further. */
+  if ( ( pa_sprite >= SPRITE_COUNT ) || ( pb_sprite >= SPRITE_COUNT ) )
   {
     return false;
   }
+  la_sprite = &m_sprites[pa_sprite];
+  lb_sprite = &m_sprites[pb_sprite];
 
   /* Next up, work out the bounds of both sprites, taking into account alignment. */
   la_bounds.w = la_sprite->width;
   la_bounds.h = la_sprite->height;
-  la_bounds.x = m_align_x( pa_column, la_sprite, pa_align );
-  la_bounds.y = m_align_y( pa_row, la_sprite, pa_align );
+  la_bounds.x = m_align_x( pa_column, la_sprite->width, pa_align );
+  la_bounds.y = m_align_y( pa_row, la_sprite->height, pa_align );
   
   lb_bounds.w = lb_sprite->width;
   lb_bounds.h = lb_sprite->height;
-  lb_bounds.x = m_align_x( pb_column, lb_sprite, pb_align );
-  lb_bounds.y = m_align_y( pb_row, lb_sprite, pb_align );
+  lb_bounds.x = m_align_x( pb_column, lb_sprite->width, pb_align );
+  lb_bounds.y = m_align_y( pb_row, lb_sprite->height, pb_align );
   
   /* Now, if these rectangles don't intersect there can't be a collision. */
   if ( !la_bounds.intersects( lb_bounds ) )
@@ -321,12 +768,32 @@ bool sprite_collide( const char *pa_sprite, int16_t pa_column, int16_t pa_row, s
     return false;
   }
   
-  /* For now then, let's assume a collision :) */
-  return true;
-  
-  
-  
-  /* If we've got to the end, we found no further collisions. */
+  /* Without masks for both, the bounding boxes are all we have to go on. */
+  if ( ( la_sprite->mask == NULL ) || ( lb_sprite->mask == NULL ) )
+  {
+    return true;
+  }
+
+  /* Otherwise, look for any pixel in the overlap that's solid in both. */
+  l_left = ( la_bounds.x > lb_bounds.x ) ? la_bounds.x : lb_bounds.x;
+  l_top = ( la_bounds.y > lb_bounds.y ) ? la_bounds.y : lb_bounds.y;
+  l_right = ( la_bounds.x + la_bounds.w < lb_bounds.x + lb_bounds.w ) ?
+            la_bounds.x + la_bounds.w : lb_bounds.x + lb_bounds.w;
+  l_bottom = ( la_bounds.y + la_bounds.h < lb_bounds.y + lb_bounds.h ) ?
+             la_bounds.y + la_bounds.h : lb_bounds.y + lb_bounds.h;
+  for ( l_y = l_top; l_y < l_bottom; l_y++ )
+  {
+    for ( l_x = l_left; l_x < l_right; l_x++ )
+    {
+      if ( _sprite_solid( la_sprite, l_x - la_bounds.x, l_y - la_bounds.y ) &&
+           _sprite_solid( lb_sprite, l_x - lb_bounds.x, l_y - lb_bounds.y ) )
+      {
+        return true;
+      }
+    }
+  }
+
+  /* The boxes touch, but the sprites themselves don't. */
   return false;
 }
 
@@ -0,0 +1,160 @@
+/*
+ * storage.cpp - part of 32Blox, a breakout game for the 32blit built to
+ * explore the API.
+ *
+ * The backend for long-term storage; a flat block of bytes that we can read
+ * and write at given offsets. Anything cleverer (versions, spare copies and
+ * so on) is up to whoever is storing things, though there's a shared CRC for
+ * them to check their records with.
+ *
+ * On the host build, this is just a plain file alongside the executable. The
+ * device doesn't (yet) expose any persistent storage through the API, so
+ * there everything politely fails and the game carries on without it.
+ *
+ * Please note that this is a first attempt at understanding a somewhat fluid
+ * API on a shiny new bit of kit, so it probably is not full of 'best practice'.
+ * It will hopefully serve as some sort of starting point, however.
+ *
+ * Coyright (C) 2020 Pete Favelle <pete@fsquared.co.uk>
+ *
+ * This software is provided under the MIT License. See LICENSE.txt for details.
+ */
+
+/* System headers. */
+
+#include <stdio.h>
+
+
+/* Local headers. */
+
+#include "32blit.hpp"
+#include "32blox.hpp"
+
+
+/* Constants. */
+
+#define STORAGE_FILENAME  "32blox.sav"
+
+
+/* Functions. */
+
+/*
+ * storage_crc - a plain CRC-32 over a block of bytes. Records are small, so
+ *               there's no need for a lookup table.
+ *
+ * const uint8_t * - the data to check
+ * uint32_t        - the number of bytes
+ *
+ * Returns the CRC.
+ */
+
+uint32_t storage_crc( const uint8_t *p_data, uint32_t p_length )
+{
+  uint32_t l_crc = 0xffffffff;
+  uint8_t  l_bit;
+  
+  while ( p_length-- > 0 )
+  {
+    l_crc ^= *p_data++;
+    for ( l_bit = 0; l_bit < 8; l_bit++ )
+    {
+      l_crc = ( l_crc >> 1 ) ^ ( ( l_crc & 1 ) ? 0xedb88320 : 0 );
+    }
+  }
+  return ~l_crc;
+}
+
+
+#ifndef TARGET_32BLIT_HW
+
+/*
+ * storage_read - reads a block of bytes from storage.
+ *
+ * uint32_t  - the offset into storage to read from
+ * uint8_t * - the buffer to read into
+ * uint32_t  - the number of bytes to read
+ *
+ * Returns bool, true if all the bytes were read.
+ */
+
+bool storage_read( uint32_t p_offset, uint8_t *p_buffer, uint32_t p_length )
+{
+  FILE  *l_fptr;
+  size_t l_read;
+
+  l_fptr = fopen( STORAGE_FILENAME, "rb" );
+  if ( l_fptr == NULL )
+  {
+    return false;
+  }
+
+  l_read = 0;
+  if ( fseek( l_fptr, p_offset, SEEK_SET ) == 0 )
+  {
+    l_read = fread( p_buffer, 1, p_length, l_fptr );
+  }
+  fclose( l_fptr );
+
+  return ( l_read == p_length );
+}
+
+
+/*
+ * storage_write - writes a block of bytes into storage, making it as sure
+ *                 as we can that it has really landed before returning.
+ *
+ * uint32_t        - the offset into storage to write to
+ * const uint8_t * - the data to write
+ * uint32_t        - the number of bytes to write
+ *
+ * Returns bool, true if all the bytes were written.
+ */
+
+bool storage_write( uint32_t p_offset, const uint8_t *p_buffer, uint32_t p_length )
+{
+  FILE  *l_fptr;
+  size_t l_written;
+
+  /* Open for update if it exists, otherwise create it. */
+  l_fptr = fopen( STORAGE_FILENAME, "r+b" );
+  if ( l_fptr == NULL )
+  {
+    l_fptr = fopen( STORAGE_FILENAME, "w+b" );
+  }
+  if ( l_fptr == NULL )
+  {
+    return false;
+  }
+
+  l_written = 0;
+  if ( fseek( l_fptr, p_offset, SEEK_SET ) == 0 )
+  {
+    l_written = fwrite( p_buffer, 1, p_length, l_fptr );
+  }
+  if ( fflush( l_fptr ) != 0 )
+  {
+    l_written = 0;
+  }
+  fclose( l_fptr );
+
+  return ( l_written == p_length );
+}
+
+#else /* TARGET_32BLIT_HW */
+
+bool storage_read( uint32_t p_offset, uint8_t *p_buffer, uint32_t p_length )
+{
+  /* Nothing to read from on the device, for now. */
+  return false;
+}
+
+bool storage_write( uint32_t p_offset, const uint8_t *p_buffer, uint32_t p_length )
+{
+  /* Nor anywhere to write to. */
+  return false;
+}
+
+#endif /* TARGET_32BLIT_HW */
+
+
+/* End of storage.cpp */
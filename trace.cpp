@@ -0,0 +1,184 @@
+/*
+ * trace.cpp - part of 32Blox, a breakout game for the 32blit built to
+ * explore the API.
+ *
+ * Timeline tracing, only built in on the host when BLOX_TRACE is defined.
+ * The TRACE_ macros record begin and end events into a buffer owned by the
+ * calling thread, so recording never takes a lock; when the program exits,
+ * everything is written out as Chrome trace-event JSON which can be loaded
+ * into chrome://tracing (or Perfetto) and stepped through frame by frame.
+ *
+ * Please note that this is a first attempt at understanding a somewhat fluid
+ * API on a shiny new bit of kit, so it probably is not full of 'best practice'.
+ * It will hopefully serve as some sort of starting point, however.
+ *
+ * Coyright (C) 2020 Pete Favelle <pete@fsquared.co.uk>
+ *
+ * This software is provided under the MIT License. See LICENSE.txt for details.
+ */
+
+#if defined( BLOX_TRACE ) && !defined( TARGET_32BLIT_HW )
+
+/* System headers. */
+
+#include <atomic>
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+
+
+/* Local headers. */
+
+#include "32blit.hpp"
+#include "32blox.hpp"
+
+
+/* Constants. */
+
+#define TRACE_FILENAME      "32blox-trace.json"
+#define TRACE_MAX_THREADS   4
+#define TRACE_MAX_EVENTS    262144      /* Per thread; a few minutes of play. */
+
+
+/* Module variables. */
+
+typedef struct {
+  const char           *name;
+  uint64_t              time;           /* Nanoseconds since we started.     */
+  char                  phase;          /* 'B'egin or 'E'nd.                 */
+} trace_event_t;
+
+typedef struct {
+  uint32_t              thread;
+  std::atomic<uint32_t> count;          /* Only ever written by its owner.   */
+  trace_event_t         events[TRACE_MAX_EVENTS];
+} trace_buffer_t;
+
+static trace_buffer_t               m_buffers[TRACE_MAX_THREADS];
+static std::atomic<uint32_t>        m_buffer_count;
+static std::atomic<bool>            m_dropped;
+static thread_local trace_buffer_t *m_buffer;
+static std::chrono::steady_clock::time_point m_epoch = std::chrono::steady_clock::now();
+
+
+/* Module functions. */
+
+/*
+ * _trace_claim_buffer - hands the calling thread a buffer of its own; the
+ *                       first time through, we also arrange to be dumped.
+ */
+
+static trace_buffer_t *_trace_claim_buffer( void )
+{
+  uint32_t l_index;
+
+  l_index = m_buffer_count.fetch_add( 1 );
+  if ( l_index >= TRACE_MAX_THREADS )
+  {
+    m_buffer_count = TRACE_MAX_THREADS;
+    return NULL;
+  }
+  if ( l_index == 0 )
+  {
+    atexit( trace_dump );
+  }
+
+  m_buffers[l_index].thread = l_index + 1;
+  return &m_buffers[l_index];
+}
+
+
+/* Functions. */
+
+/*
+ * trace_event - records a single event for the calling thread.
+ *
+ * const char * - the name of the event; must be a string literal, or
+ *                otherwise live until the trace is dumped
+ * char         - the phase, 'B' or 'E'
+ */
+
+void trace_event( const char *p_name, char p_phase )
+{
+  trace_event_t *l_event;
+  uint32_t       l_count;
+
+  /* First event on this thread? */
+  if ( m_buffer == NULL )
+  {
+    m_buffer = _trace_claim_buffer();
+    if ( m_buffer == NULL )
+    {
+      m_dropped = true;
+      return;
+    }
+  }
+
+  /* If we've filled up, just stop recording. */
+  l_count = m_buffer->count.load( std::memory_order_relaxed );
+  if ( l_count >= TRACE_MAX_EVENTS )
+  {
+    m_dropped = true;
+    return;
+  }
+
+  l_event = &m_buffer->events[l_count];
+  l_event->name = p_name;
+  l_event->phase = p_phase;
+  l_event->time = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now() - m_epoch ).count();
+
+  /* Publish it, so a dump from another thread sees the whole event. */
+  m_buffer->count.store( l_count + 1, std::memory_order_release );
+}
+
+
+/*
+ * trace_dump - writes everything recorded so far out as trace-event JSON.
+ *              This is called automatically at exit.
+ */
+
+void trace_dump( void )
+{
+  FILE          *l_fptr;
+  uint32_t       l_buffer, l_buffers, l_index, l_count;
+  trace_event_t *l_event;
+  bool           l_first = true;
+
+  l_fptr = fopen( TRACE_FILENAME, "w" );
+  if ( l_fptr == NULL )
+  {
+    printf( "trace: unable to write %s\n", TRACE_FILENAME );
+    return;
+  }
+
+  fprintf( l_fptr, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n" );
+  l_buffers = m_buffer_count.load();
+  if ( l_buffers > TRACE_MAX_THREADS )
+  {
+    l_buffers = TRACE_MAX_THREADS;
+  }
+  for ( l_buffer = 0; l_buffer < l_buffers; l_buffer++ )
+  {
+    l_count = m_buffers[l_buffer].count.load( std::memory_order_acquire );
+    for ( l_index = 0; l_index < l_count; l_index++ )
+    {
+      l_event = &m_buffers[l_buffer].events[l_index];
+      fprintf( l_fptr, "%s{\"name\":\"%s\",\"ph\":\"%c\",\"ts\":%llu.%03u,\"pid\":1,\"tid\":%lu}",
+               l_first ? "" : ",\n", l_event->name, l_event->phase,
+               (unsigned long long)( l_event->time / 1000 ), (unsigned)( l_event->time % 1000 ),
+               (unsigned long)m_buffers[l_buffer].thread );
+      l_first = false;
+    }
+  }
+  fprintf( l_fptr, "\n]}\n" );
+  fclose( l_fptr );
+
+  printf( "trace: written to %s%s\n", TRACE_FILENAME,
+          m_dropped ? " (buffer filled, later events were dropped)" : "" );
+}
+
+#endif /* BLOX_TRACE && !TARGET_32BLIT_HW */
+
+
+/* End of trace.cpp */